@@ -54,6 +54,8 @@ if (WITH_TLS)
                 set(TLS_SOURCES ${TLS_SOURCES}
                     src/base/net/http2/Http2Client.cpp
                     src/base/net/http2/Http2Client.h
+                    src/base/net/http2/Http2Session.cpp
+                    src/base/net/http2/Http2Session.h
                     )
                 include_directories(${NGHTTP2_INCLUDE_DIR})
                 add_definitions(/DXMRIG_FEATURE_HTTP2)
@@ -0,0 +1,13 @@
+if (WITH_ZLIB)
+    find_package(ZLIB)
+
+    if (ZLIB_FOUND)
+        add_definitions(/DXMRIG_FEATURE_ZLIB)
+        include_directories(${ZLIB_INCLUDE_DIRS})
+    else()
+        set(ZLIB_LIBRARIES "")
+        message(STATUS "zlib not found, rotated log files are kept uncompressed")
+    endif()
+else()
+    set(ZLIB_LIBRARIES "")
+endif()
@@ -23,6 +23,7 @@
 
 #include "App.h"
 #include "base/io/Console.h"
+#include "base/io/log/FileLogWriter.h"
 #include "base/io/log/Log.h"
 #include "base/io/log/Tags.h"
 #include "base/io/Signals.h"
@@ -96,6 +97,13 @@ void xmrig::App::onConsoleCommand(char command)
 
 void xmrig::App::onSignal(int signum)
 {
+#   ifndef XMRIG_OS_WIN
+    if (signum == SIGHUP) {
+        FileLogWriter::reopen();
+        return;
+    }
+#   endif
+
     if (signum == SIGHUP || signum == SIGTERM || signum == SIGINT) {
         close();
     }
@@ -24,16 +24,29 @@
 
 #include "api/v1/ApiRouter.h"
 #include "3rdparty/rapidjson/document.h"
+#include "3rdparty/rapidjson/stringbuffer.h"
+#include "3rdparty/rapidjson/writer.h"
 #include "base/api/interfaces/IApiRequest.h"
 #include "base/kernel/Platform.h"
+#include "base/net/dns/Dns.h"
+#include "base/net/http/HttpChunkedStream.h"
+#include "base/net/http/HttpQuery.h"
+#include "base/tools/Chrono.h"
 #include "base/tools/Buffer.h"
 #include "core/config/Config.h"
 #include "core/Controller.h"
+#include "proxy/AsyncEvents.h"
 #include "proxy/Counters.h"
+#include "proxy/LoopMonitor.h"
 #include "proxy/Miner.h"
+#include "proxy/Profiler.h"
+#include "proxy/Proxy.h"
+#include "proxy/TimeSeries.h"
+#include "proxy/workers/Workers.h"
 #include "version.h"
 
 
+#include <algorithm>
 #include <cmath>
 #include <csignal>
 #include <cstring>
@@ -50,6 +63,281 @@ static inline double normalize(double d)
 }
 
 
+namespace xmrig {
+
+
+using JsonWriter   = rapidjson::Writer<rapidjson::StringBuffer>;
+using StreamWriter = rapidjson::Writer<HttpChunkedStream>;
+
+
+// a page without a limit gets kPageSize rows, larger limits are clamped so one request stays bounded.
+static constexpr size_t kPageSize    = 1000;
+static constexpr size_t kMaxPageSize = 10000;
+
+
+// a list column, exactly one accessor is set; string columns are the ones matched by "filter".
+template<typename T>
+struct Column
+{
+    const char *name;
+    uint64_t (*number)(const T &row);
+    double (*real)(const T &row);
+    const char *(*string)(const T &row);
+};
+
+
+static const Column<Miner> kMinerColumns[] = {
+    { "id",         [](const Miner &m) { return static_cast<uint64_t>(m.id()); },         nullptr, nullptr },
+    { "ip",         nullptr, nullptr, [](const Miner &m) { return m.ip(); } },
+    { "tx",         [](const Miner &m) { return m.tx(); },                                nullptr, nullptr },
+    { "rx",         [](const Miner &m) { return m.rx(); },                                nullptr, nullptr },
+    { "state",      [](const Miner &m) { return static_cast<uint64_t>(m.state()); },      nullptr, nullptr },
+    { "diff",       [](const Miner &m) { return m.diff(); },                              nullptr, nullptr },
+    { "user",       nullptr, nullptr, [](const Miner &m) { return m.user().data(); } },
+    { "password",   nullptr, nullptr, [](const Miner &m) { return m.password().data(); } },
+    { "rig_id",     nullptr, nullptr, [](const Miner &m) { return m.rigId().data(); } },
+    { "agent",      nullptr, nullptr, [](const Miner &m) { return m.agent().data(); } },
+    { "share_rate", nullptr, [](const Miner &m) { return m.vardiff().shareRate(Chrono::steadyMSecs()); }, nullptr },
+    { "retargets",  [](const Miner &m) { return static_cast<uint64_t>(m.vardiff().retargets()); }, nullptr, nullptr }
+};
+
+
+static const Column<Worker> kWorkerColumns[] = {
+    { "name",         nullptr, nullptr, [](const Worker &w) { return w.name(); } },
+    { "ip",           nullptr, nullptr, [](const Worker &w) { return w.ip(); } },
+    { "connections",  [](const Worker &w) { return w.connections(); }, nullptr, nullptr },
+    { "accepted",     [](const Worker &w) { return w.accepted(); },    nullptr, nullptr },
+    { "rejected",     [](const Worker &w) { return w.rejected(); },    nullptr, nullptr },
+    { "invalid",      [](const Worker &w) { return w.invalid(); },     nullptr, nullptr },
+    { "hashes",       [](const Worker &w) { return w.hashes(); },      nullptr, nullptr },
+    { "last_hash",    [](const Worker &w) { return w.lastHash(); },    nullptr, nullptr },
+    { "hashrate_1m",  nullptr, [](const Worker &w) { return w.hashrate(60); },        nullptr },
+    { "hashrate_10m", nullptr, [](const Worker &w) { return w.hashrate(600); },       nullptr },
+    { "hashrate_1h",  nullptr, [](const Worker &w) { return w.hashrate(3600); },      nullptr },
+    { "hashrate_12h", nullptr, [](const Worker &w) { return w.hashrate(3600 * 12); }, nullptr },
+    { "hashrate_24h", nullptr, [](const Worker &w) { return w.hashrate(3600 * 24); }, nullptr }
+};
+
+
+static size_t pageSize(const HttpQuery &query)
+{
+    const uint64_t limit = query.getUint64("limit");
+
+    return limit ? static_cast<size_t>(std::min<uint64_t>(limit, kMaxPageSize)) : kPageSize;
+}
+
+
+// sort keys are read once per row, share_rate depends on the clock and must not change in the middle of a sort.
+struct SortKey
+{
+    uint64_t number    = 0;
+    double real        = 0.0;
+    const char *string = nullptr;
+};
+
+
+template<typename T>
+static SortKey sortKey(const Column<T> &column, const T &row)
+{
+    SortKey key;
+
+    if (column.number) {
+        key.number = column.number(row);
+    }
+    else if (column.real) {
+        key.real = column.real(row);
+    }
+    else {
+        key.string = column.string(row);
+    }
+
+    return key;
+}
+
+
+template<typename T>
+static bool less(const Column<T> &column, const SortKey &a, const SortKey &b)
+{
+    if (column.number) {
+        return a.number < b.number;
+    }
+
+    if (column.real) {
+        return a.real < b.real;
+    }
+
+    return strcmp(a.string ? a.string : "", b.string ? b.string : "") < 0;
+}
+
+
+template<typename Writer, typename T>
+static void write(Writer &writer, const Column<T> &column, const T &row)
+{
+    if (column.number) {
+        writer.Uint64(column.number(row));
+    }
+    else if (column.real) {
+        writer.Double(normalize(column.real(row)));
+    }
+    else {
+        const char *value = column.string(row);
+        value ? writer.String(value) : writer.Null();
+    }
+}
+
+
+/**
+ * Filters, sorts and writes one page of rows as arrays in "format" order.
+ *
+ * Query parameters: fields (comma separated column names), filter (substring of any string column),
+ * sort (column name), order (asc or desc), limit (rows per page, see kPageSize) and cursor (the "next" value of the previous page).
+ */
+template<typename T, size_t N>
+static void writeTable(StreamWriter &writer, const char *key, std::vector<const T *> &rows, const Column<T> (&columns)[N], const HttpQuery &query)
+{
+    std::vector<const Column<T> *> fields;
+    const Column<T> *sort = nullptr;
+
+    const char *names = query.get("fields");
+    const char *order = query.get("order");
+    const char *by    = query.get("sort");
+
+    for (size_t i = 0; i < N; ++i) {
+        const size_t size = strlen(columns[i].name);
+
+        if (names) {
+            for (const char *p = strstr(names, columns[i].name); p; p = strstr(p + 1, columns[i].name)) {
+                if ((p == names || p[-1] == ',') && (p[size] == ',' || p[size] == '\0')) {
+                    fields.push_back(&columns[i]);
+                    break;
+                }
+            }
+        }
+
+        if (by && strcmp(by, columns[i].name) == 0) {
+            sort = &columns[i];
+        }
+    }
+
+    if (fields.empty()) {
+        for (size_t i = 0; i < N; ++i) {
+            fields.push_back(&columns[i]);
+        }
+    }
+
+    const char *filter = query.get("filter");
+    if (filter && *filter) {
+        rows.erase(std::remove_if(rows.begin(), rows.end(), [&columns, filter](const T *row) {
+            for (size_t i = 0; i < N; ++i) {
+                const char *value = columns[i].string ? columns[i].string(*row) : nullptr;
+                if (value && strstr(value, filter)) {
+                    return false;
+                }
+            }
+
+            return true;
+        }), rows.end());
+    }
+
+    const size_t total  = rows.size();
+    const size_t limit  = pageSize(query);
+    const size_t cursor = std::min(static_cast<size_t>(query.getUint64("cursor")), total);
+    const size_t end    = std::min(cursor + limit, total);
+
+    if (sort) {
+        const bool desc = order && strcmp(order, "desc") == 0;
+        const Column<T> &first = columns[0];
+
+        struct Entry
+        {
+            SortKey key;
+            SortKey tie;
+            const T *row;
+        };
+
+        std::vector<Entry> entries;
+        entries.reserve(total);
+
+        for (const T *row : rows) {
+            entries.push_back({ sortKey(*sort, *row), sortKey(first, *row), row });
+        }
+
+        // ties fall back to the first column, so pages stay stable between requests.
+        auto compare = [sort, desc, &first](const Entry &a, const Entry &b) {
+            if (less(*sort, a.key, b.key)) {
+                return !desc;
+            }
+
+            if (less(*sort, b.key, a.key)) {
+                return desc;
+            }
+
+            return less(first, a.tie, b.tie);
+        };
+
+        if (end < total) {
+            std::partial_sort(entries.begin(), entries.begin() + static_cast<ptrdiff_t>(end), entries.end(), compare);
+        }
+        else {
+            std::sort(entries.begin(), entries.end(), compare);
+        }
+
+        for (size_t i = 0; i < end; ++i) {
+            rows[i] = entries[i].row;
+        }
+    }
+
+    writer.Key("format");
+    writer.StartArray();
+    for (const Column<T> *field : fields) {
+        writer.String(field->name);
+    }
+    writer.EndArray();
+
+    writer.Key(key);
+    writer.StartArray();
+    for (size_t i = cursor; i < end; ++i) {
+        writer.StartArray();
+        for (const Column<T> *field : fields) {
+            write(writer, *field, *rows[i]);
+        }
+        writer.EndArray();
+    }
+    writer.EndArray();
+
+    writer.Key("total");
+    writer.Uint64(total);
+
+    writer.Key("next");
+    end < total ? writer.Uint64(end) : writer.Null();
+}
+
+
+// hashrate in H/s rounded to integers, the first value is absolute and every next one is a delta to the previous.
+static void writeSeries(StreamWriter &writer, const char *name, const TimeSeries &series, TimeSeries::Resolution resolution, uint64_t begin, uint64_t end)
+{
+    writer.StartObject();
+    writer.Key("name");
+    writer.String(name);
+
+    writer.Key("data");
+    writer.StartArray();
+
+    int64_t prev = 0;
+    for (uint64_t bucket = begin; bucket < end; ++bucket) {
+        const int64_t value = std::llround(series.value(resolution, bucket));
+        writer.Int64(value - prev);
+        prev = value;
+    }
+
+    writer.EndArray();
+    writer.EndObject();
+}
+
+
+} /* namespace xmrig */
+
+
 xmrig::ApiRouter::ApiRouter(Base *base) :
     m_base(base)
 {
@@ -59,8 +347,271 @@ xmrig::ApiRouter::ApiRouter(Base *base) :
 xmrig::ApiRouter::~ApiRouter() = default;
 
 
+bool xmrig::ApiRouter::onStream(const HttpQuery &query, HttpChunkedStream &out)
+{
+    if (query.path() == "/1/series") {
+        return getSeries(query, out);
+    }
+
+    const bool workers = query.path() == "/1/workers";
+    if (!workers && query.path() != "/1/miners") {
+        return false;
+    }
+
+    LoopMonitor::Scope scope(LoopMonitor::ApiSource, query.path().c_str());
+
+    auto controller = static_cast<Controller *>(m_base);
+    StreamWriter writer(out);
+    writer.StartObject();
+
+    if (workers) {
+        auto &stats = controller->statsData();
+
+        writer.Key("hashrate");
+        writer.StartObject();
+        writer.Key("total");
+        writer.StartArray();
+        for (double hashrate : stats.hashrate) {
+            writer.Double(normalize(hashrate));
+        }
+        writer.EndArray();
+        writer.EndObject();
+
+        writer.Key("mode");
+        writer.String(Workers::modeName(controller->config()->workersMode()));
+
+        m_workerRows.clear();
+        for (const Worker &worker : controller->workers()) {
+            m_workerRows.push_back(&worker);
+        }
+
+        writeTable(writer, "workers", m_workerRows, kWorkerColumns, query);
+    }
+    else {
+        m_minerRows.clear();
+        for (const auto &kv : controller->miners()) {
+            if (kv.second->mapperId() != -1) {
+                m_minerRows.push_back(kv.second);
+            }
+        }
+
+        writeTable(writer, "miners", m_minerRows, kMinerColumns, query);
+    }
+
+    writer.EndObject();
+
+    return true;
+}
+
+
+/**
+ * Hashrate history, query parameters:
+ * res (1m, 15m or 1h), from and to (unix seconds), scope (global, upstream or worker),
+ * name (a single upstream or worker, 404 if unknown) and limit/cursor to page through workers.
+ */
+bool xmrig::ApiRouter::getSeries(const HttpQuery &query, HttpChunkedStream &out) const
+{
+    const auto resolution = TimeSeries::parse(query.get("res"));
+    const char *scope     = query.get("scope");
+    const char *name      = query.get("name");
+
+    if (resolution == TimeSeries::ResolutionMax || (scope && strcmp(scope, "global") != 0 && strcmp(scope, "upstream") != 0 && strcmp(scope, "worker") != 0)) {
+        return false;
+    }
+
+    LoopMonitor::Scope monitor(LoopMonitor::ApiSource, query.path().c_str());
+
+    auto controller      = static_cast<Controller *>(m_base);
+    const Stats &stats   = controller->proxy()->stats();
+    const auto &workers  = controller->workers();
+    const Worker *worker = nullptr;
+
+    // an unknown upstream or worker name falls through to a 404 instead of an empty list.
+    if (name && scope && strcmp(scope, "upstream") == 0 && !stats.upstreamSeries().count(name)) {
+        return false;
+    }
+
+    if (name && scope && strcmp(scope, "worker") == 0) {
+        for (const Worker &w : workers) {
+            if (strcmp(w.name(), name) == 0) {
+                worker = &w;
+                break;
+            }
+        }
+
+        if (!worker) {
+            return false;
+        }
+    }
+
+    const uint64_t step = TimeSeries::step(resolution);
+    const uint64_t size = TimeSeries::size(resolution);
+    const uint64_t to   = query.getUint64("to");
+
+    // every series is closed on the same minute, so the global one tells where the history ends.
+    uint64_t end = stats.series().next(resolution);
+    if (to) {
+        end = std::min(end, to / step + (to % step ? 1 : 0));
+    }
+
+    const uint64_t begin = std::min(end, std::max(end > size ? end - size : 0, query.getUint64("from") / step));
+
+    StreamWriter writer(out);
+    writer.StartObject();
+
+    writer.Key("res");
+    writer.String(TimeSeries::name(resolution));
+    writer.Key("step");
+    writer.Uint64(step);
+    writer.Key("start");
+    writer.Uint64(begin * step);
+    writer.Key("count");
+    writer.Uint64(end - begin);
+
+    writer.Key("series");
+    writer.StartArray();
+
+    size_t total = 0;
+    size_t next  = 0;
+
+    if (!scope || strcmp(scope, "global") == 0) {
+        writeSeries(writer, "global", stats.series(), resolution, begin, end);
+        total = 1;
+    }
+    else if (strcmp(scope, "upstream") == 0) {
+        for (const auto &kv : stats.upstreamSeries()) {
+            if (!name || kv.first == name) {
+                writeSeries(writer, kv.first.c_str(), kv.second, resolution, begin, end);
+                total++;
+            }
+        }
+    }
+    else if (worker) {
+        writeSeries(writer, worker->name(), worker->series(), resolution, begin, end);
+        total = 1;
+    }
+    else {
+        const size_t limit  = pageSize(query);
+        const size_t cursor = std::min(static_cast<size_t>(query.getUint64("cursor")), workers.size());
+
+        for (size_t i = cursor; i < workers.size(); ++i) {
+            if (i >= cursor + limit) {
+                next = i;
+                break;
+            }
+
+            writeSeries(writer, workers[i].name(), workers[i].series(), resolution, begin, end);
+        }
+
+        total = workers.size();
+    }
+
+    writer.EndArray();
+
+    writer.Key("total");
+    writer.Uint64(total);
+
+    writer.Key("next");
+    next ? writer.Uint64(next) : writer.Null();
+
+    writer.EndObject();
+
+    return true;
+}
+
+
+void xmrig::ApiRouter::onPush(std::string &out, bool full)
+{
+    using namespace rapidjson;
+
+    auto controller   = static_cast<Controller *>(m_base);
+    const auto &list  = controller->workers();
+    const auto evicted = controller->proxy()->evictedWorkers();
+
+    if (!full && (++m_pushTicks % kPushWorkersInterval) != 0) {
+        return;
+    }
+
+    // eviction compacts the list and a mode change clears it, rows are resent instead of tracked by id.
+    const bool reset = full || evicted != m_pushEvicted || list.size() < m_rowHashes.size();
+    if (reset && !full) {
+        m_rowHashes.clear();
+        m_pushEvicted = evicted;
+    }
+
+    StringBuffer buffer(nullptr, 4096);
+    JsonWriter writer(buffer);
+    StringBuffer row(nullptr, 256);
+
+    writer.StartObject();
+    writer.Key("reset");
+    writer.Bool(reset);
+
+    if (reset) {
+        writer.Key("mode");
+        writer.String(Workers::modeName(controller->config()->workersMode()));
+
+        writer.Key("format");
+        writer.StartArray();
+        for (const auto &column : kWorkerColumns) {
+            writer.String(column.name);
+        }
+        writer.EndArray();
+    }
+
+    writer.Key("rows");
+    writer.StartArray();
+
+    size_t changed = 0;
+
+    for (size_t i = 0; i < list.size(); ++i) {
+        row.Clear();
+        JsonWriter rowWriter(row);
+
+        rowWriter.StartArray();
+        for (const auto &column : kWorkerColumns) {
+            write(rowWriter, column, list[i]);
+        }
+        rowWriter.EndArray();
+
+        uint64_t hash = 0xcbf29ce484222325ULL;
+        for (size_t j = 0; j < row.GetSize(); ++j) {
+            hash = (hash ^ static_cast<uint8_t>(row.GetString()[j])) * 0x100000001b3ULL;
+        }
+
+        if (!full) {
+            if (i >= m_rowHashes.size()) {
+                m_rowHashes.push_back(0);
+            }
+
+            if (m_rowHashes[i] == hash && !reset) {
+                continue;
+            }
+
+            m_rowHashes[i] = hash;
+        }
+
+        writer.RawValue(row.GetString(), row.GetSize(), kArrayType);
+        changed++;
+    }
+
+    writer.EndArray();
+    writer.EndObject();
+
+    if (!changed && !reset) {
+        return;
+    }
+
+    out += "event: workers\ndata: ";
+    out.append(buffer.GetString(), buffer.GetSize());
+    out += "\n\n";
+}
+
+
 void xmrig::ApiRouter::onRequest(IApiRequest &request)
 {
+    LoopMonitor::Scope scope(LoopMonitor::ApiSource, request.url().data());
+
     if (request.method() == IApiRequest::METHOD_GET) {
         if (request.type() == IApiRequest::REQ_SUMMARY) {
             request.accept();
@@ -68,15 +619,12 @@ void xmrig::ApiRouter::onRequest(IApiRequest &request)
             getHashrate(request.reply(), request.doc());
             getMinersSummary(request.reply(), request.doc());
             getResults(request.reply(), request.doc());
-        }
-        else if (request.url() == "/1/workers") {
-            request.accept();
-            getHashrate(request.reply(), request.doc());
-            getWorkers(request.reply(), request.doc());
-        }
-        else if (request.url() == "/1/miners") {
-            request.accept();
-            getMiners(request.reply(), request.doc());
+
+            request.reply().AddMember("loop", LoopMonitor::toJSON(request.doc()), request.doc().GetAllocator());
+            request.reply().AddMember("event_queue", static_cast<Controller *>(m_base)->proxy()->events().toJSON(request.doc()), request.doc().GetAllocator());
+            request.reply().AddMember("dns", Dns::toJSON(request.doc()), request.doc().GetAllocator());
+
+            static_cast<Controller *>(m_base)->proxy()->getPools(request.reply(), request.doc());
         }
     }
     else if (request.method() == IApiRequest::METHOD_POST) {
@@ -132,52 +680,6 @@ void xmrig::ApiRouter::getMiner(rapidjson::Value &reply, rapidjson::Document &do
 }
 
 
-void xmrig::ApiRouter::getMiners(rapidjson::Value &reply, rapidjson::Document &doc) const
-{
-    using namespace rapidjson;
-
-    auto &allocator = doc.GetAllocator();
-    auto list       = static_cast<Controller *>(m_base)->miners();
-
-    Value miners(kArrayType);
-
-    for (const xmrig::Miner *miner : list) {
-        if (miner->mapperId() == -1) {
-            continue;
-        }
-
-        Value value(kArrayType);
-        value.PushBack(miner->id(),                allocator);
-        value.PushBack(StringRef(miner->ip()),     allocator);
-        value.PushBack(miner->tx(),                allocator);
-        value.PushBack(miner->rx(),                allocator);
-        value.PushBack(miner->state(),             allocator);
-        value.PushBack(miner->diff(),              allocator);
-        value.PushBack(miner->user().toJSON(),     allocator);
-        value.PushBack(miner->password().toJSON(), allocator);
-        value.PushBack(miner->rigId().toJSON(),    allocator);
-        value.PushBack(miner->agent().toJSON(),    allocator);
-
-        miners.PushBack(value, allocator);
-    }
-
-    Value format(kArrayType);
-    format.PushBack("id",       allocator);
-    format.PushBack("ip",       allocator);
-    format.PushBack("tx",       allocator);
-    format.PushBack("rx",       allocator);
-    format.PushBack("state",    allocator);
-    format.PushBack("diff",     allocator);
-    format.PushBack("user",     allocator);
-    format.PushBack("password", allocator);
-    format.PushBack("rig_id",   allocator);
-    format.PushBack("agent",    allocator);
-
-    reply.AddMember("format", format, allocator);
-    reply.AddMember("miners", miners, allocator);
-}
-
-
 void xmrig::ApiRouter::getMinersSummary(rapidjson::Value &reply, rapidjson::Document &doc) const
 {
     auto &allocator = doc.GetAllocator();
@@ -187,9 +689,12 @@ void xmrig::ApiRouter::getMinersSummary(rapidjson::Value &reply, rapidjson::Docu
 
     miners.AddMember("now", stats.miners, allocator);
     miners.AddMember("max", stats.maxMiners, allocator);
+    miners.AddMember("first_job_us", Counters::firstJob.toJSON(doc), allocator);
 
     reply.AddMember("miners",  miners, allocator);
     reply.AddMember("workers", static_cast<uint64_t>(static_cast<Controller *>(m_base)->workers().size()), allocator);
+    reply.AddMember("workers_live", static_cast<uint64_t>(static_cast<Controller *>(m_base)->proxy()->liveWorkers()), allocator);
+    reply.AddMember("workers_evicted", static_cast<Controller *>(m_base)->proxy()->evictedWorkers(), allocator);
 
     rapidjson::Value upstreams(rapidjson::kObjectType);
 
@@ -198,6 +703,7 @@ void xmrig::ApiRouter::getMinersSummary(rapidjson::Value &reply, rapidjson::Docu
     upstreams.AddMember("error",  stats.upstreams.error, allocator);
     upstreams.AddMember("total",  stats.upstreams.total, allocator);
     upstreams.AddMember("ratio",  normalize(stats.upstreams.ratio(Counters::miners())), allocator);
+    upstreams.AddMember("failover_ms", Counters::failover.toJSON(doc), allocator);
 
     reply.AddMember("upstreams", upstreams, allocator);
 }
@@ -216,6 +722,7 @@ void xmrig::ApiRouter::getResults(rapidjson::Value &reply, rapidjson::Document &
     results.AddMember("expired",       stats.expired, allocator);
     results.AddMember("avg_time",      stats.avgTime(), allocator);
     results.AddMember("latency",       stats.avgLatency(), allocator);
+    results.AddMember("latency_ms",    stats.latency.toJSON(doc), allocator);
     results.AddMember("hashes_total",  stats.hashes, allocator);
     results.AddMember("hashes_donate", stats.donateHashes, allocator);
 
@@ -226,38 +733,16 @@ void xmrig::ApiRouter::getResults(rapidjson::Value &reply, rapidjson::Document &
 
     results.AddMember("best", best, allocator);
 
-    reply.AddMember("results", results, allocator);
-}
+    rapidjson::Value upstreams(rapidjson::kObjectType);
+    for (const auto &kv : stats.upstreamLatency) {
+        upstreams.AddMember(rapidjson::Value(kv.first.c_str(), allocator), kv.second.toJSON(doc), allocator);
+    }
 
+    results.AddMember("upstreams", upstreams, allocator);
 
-void xmrig::ApiRouter::getWorkers(rapidjson::Value &reply, rapidjson::Document &doc) const
-{
-    using namespace rapidjson;
+#   ifdef XMRIG_FEATURE_PROFILING
+    results.AddMember("profile_us", Profiler::toJSON(doc), allocator);
+#   endif
 
-    auto &allocator = doc.GetAllocator();
-    auto &list      = static_cast<Controller *>(m_base)->workers();
-
-    Value workers(kArrayType);
-
-    for (const Worker &worker : list) {
-         Value array(kArrayType);
-         array.PushBack(StringRef(worker.name()), allocator);
-         array.PushBack(StringRef(worker.ip()), allocator);
-         array.PushBack(worker.connections(), allocator);
-         array.PushBack(worker.accepted(), allocator);
-         array.PushBack(worker.rejected(), allocator);
-         array.PushBack(worker.invalid(), allocator);
-         array.PushBack(worker.hashes(), allocator);
-         array.PushBack(worker.lastHash(), allocator);
-         array.PushBack(normalize(worker.hashrate(60)), allocator);
-         array.PushBack(normalize(worker.hashrate(600)), allocator);
-         array.PushBack(normalize(worker.hashrate(3600)), allocator);
-         array.PushBack(normalize(worker.hashrate(3600 * 12)), allocator);
-         array.PushBack(normalize(worker.hashrate(3600 * 24)), allocator);
-
-         workers.PushBack(array, allocator);
-    }
-
-    reply.AddMember("mode", StringRef(Workers::modeName(static_cast<Controller *>(m_base)->config()->workersMode())), allocator);
-    reply.AddMember("workers", workers, allocator);
+    reply.AddMember("results", results, allocator);
 }
@@ -26,8 +26,13 @@
 #define XMRIG_APIROUTER_H
 
 
+#include <vector>
+
+
 #include "3rdparty/rapidjson/fwd.h"
 #include "base/api/interfaces/IApiListener.h"
+#include "base/api/interfaces/IApiPushListener.h"
+#include "base/api/interfaces/IApiStreamListener.h"
 #include "base/tools/Object.h"
 #include "proxy/StatsData.h"
 
@@ -36,9 +41,11 @@ namespace xmrig {
 
 
 class Base;
+class Miner;
+class Worker;
 
 
-class ApiRouter : public xmrig::IApiListener
+class ApiRouter : public xmrig::IApiListener, public xmrig::IApiPushListener, public xmrig::IApiStreamListener
 {
 public:
     XMRIG_DISABLE_COPY_MOVE_DEFAULT(ApiRouter)
@@ -47,18 +54,26 @@ public:
     ~ApiRouter() override;
 
 protected:
+    bool onStream(const HttpQuery &query, HttpChunkedStream &out) override;
+    void onPush(std::string &out, bool full) override;
     void onRequest(IApiRequest &request) override;
 
 private:
+    constexpr static uint64_t kPushWorkersInterval = 5;
+
+    bool getSeries(const HttpQuery &query, HttpChunkedStream &out) const;
     void getHashrate(rapidjson::Value &reply, rapidjson::Document &doc) const;
     void getIdentify(rapidjson::Value &reply, rapidjson::Document &doc) const;
     void getMiner(rapidjson::Value &reply, rapidjson::Document &doc) const;
-    void getMiners(rapidjson::Value &reply, rapidjson::Document &doc) const;
     void getMinersSummary(rapidjson::Value &reply, rapidjson::Document &doc) const;
     void getResults(rapidjson::Value &reply, rapidjson::Document &doc) const;
-    void getWorkers(rapidjson::Value &reply, rapidjson::Document &doc) const;
 
     Base *m_base;
+    std::vector<const Miner *> m_minerRows;
+    std::vector<const Worker *> m_workerRows;
+    std::vector<uint64_t> m_rowHashes;
+    uint64_t m_pushEvicted = 0;
+    uint64_t m_pushTicks   = 0;
 };
 
 
@@ -0,0 +1,253 @@
+/* XMRig
+ * Copyright (c) 2026      HashVault   <https://github.com/HashVault>, <root@hashvault.pro>
+ *
+ *   This program is free software: you can redistribute it and/or modify
+ *   it under the terms of the GNU General Public License as published by
+ *   the Free Software Foundation, either version 3 of the License, or
+ *   (at your option) any later version.
+ *
+ *   This program is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ *   GNU General Public License for more details.
+ *
+ *   You should have received a copy of the GNU General Public License
+ *   along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#include <cinttypes>
+#include <cstdio>
+
+
+#include "api/v1/Metrics.h"
+#include "base/net/dns/Dns.h"
+#include "core/config/Config.h"
+#include "core/Controller.h"
+#include "proxy/AsyncEvents.h"
+#include "proxy/Counters.h"
+#include "proxy/Error.h"
+#include "proxy/Histogram.h"
+#include "proxy/LoopMonitor.h"
+#include "proxy/Profiler.h"
+#include "proxy/Proxy.h"
+
+
+namespace xmrig {
+
+
+static const char *kErrorLabels[Error::kCount] = {
+    "none",
+    "bad_gateway",
+    "invalid_job_id",
+    "invalid_method",
+    "invalid_nonce",
+    "low_difficulty",
+    "unauthenticated",
+    "incompatible_algorithm",
+    "incorrect_algorithm",
+    "forbidden",
+    "route_not_found"
+};
+
+
+static const char *kHashrateWindows[] = { "60", "600", "3600", "43200", "86400" };
+
+
+static void escape(std::string &out, const char *value)
+{
+    for (const char *p = value; *p; ++p) {
+        switch (*p) {
+        case '\\':
+            out += "\\\\";
+            break;
+
+        case '"':
+            out += "\\\"";
+            break;
+
+        case '\n':
+            out += "\\n";
+            break;
+
+        default:
+            out += *p;
+            break;
+        }
+    }
+}
+
+
+} // namespace xmrig
+
+
+xmrig::Metrics::Metrics(Controller *controller) :
+    m_controller(controller)
+{
+}
+
+
+void xmrig::Metrics::onMetrics(std::string &out)
+{
+    const auto &stats = m_controller->statsData();
+    Proxy *proxy      = m_controller->proxy();
+    char labels[64];
+
+    LoopMonitor::Scope scope(LoopMonitor::ApiSource, "/metrics");
+
+    gauge(out, "vltrig_uptime_seconds", "Seconds since the proxy started.", static_cast<double>(stats.uptime()));
+    gauge(out, "vltrig_connections", "Open miner connections.", static_cast<double>(stats.connections));
+    gauge(out, "vltrig_miners", "Logged in miners.", static_cast<double>(Counters::miners()));
+    gauge(out, "vltrig_miners_max", "Highest number of logged in miners.", static_cast<double>(Counters::maxMiners()));
+
+    family(out, "vltrig_workers", "gauge", "Workers known to the proxy.");
+    sample(out, "vltrig_workers", "state=\"live\"", static_cast<double>(proxy->liveWorkers()));
+    sample(out, "vltrig_workers", "state=\"stored\"", static_cast<double>(m_controller->workers().size()));
+    counter(out, "vltrig_workers_evicted", "Idle workers dropped from statistics.", proxy->evictedWorkers());
+
+    family(out, "vltrig_shares", "counter", "Shares by result.");
+    sample(out, "vltrig_shares_total", "result=\"accepted\"", static_cast<double>(stats.accepted));
+    sample(out, "vltrig_shares_total", "result=\"rejected\"", static_cast<double>(stats.rejected));
+    sample(out, "vltrig_shares_total", "result=\"invalid\"", static_cast<double>(stats.invalid));
+    sample(out, "vltrig_shares_total", "result=\"expired\"", static_cast<double>(stats.expired));
+
+    family(out, "vltrig_invalid_shares", "counter", "Shares refused by the proxy, by error code.");
+    for (size_t i = 1; i < stats.errors.size(); ++i) {
+        snprintf(labels, sizeof(labels), "code=\"%s\"", kErrorLabels[i]);
+        sample(out, "vltrig_invalid_shares_total", labels, static_cast<double>(stats.errors[i]));
+    }
+
+    counter(out, "vltrig_hashes", "Accepted share difficulty sum.", stats.hashes);
+    counter(out, "vltrig_hashes_donate", "Accepted share difficulty sum sent to the donation pool.", stats.donateHashes);
+
+    family(out, "vltrig_hashrate_khs", "gauge", "Hashrate in kH/s averaged over a window in seconds.");
+    for (size_t i = 0; i < sizeof(kHashrateWindows) / sizeof(kHashrateWindows[0]); ++i) {
+        snprintf(labels, sizeof(labels), "window=\"%s\"", kHashrateWindows[i]);
+        sample(out, "vltrig_hashrate_khs", labels, stats.hashrate[i]);
+    }
+
+    family(out, "vltrig_upstreams", "gauge", "Pool connections by state.");
+    sample(out, "vltrig_upstreams", "state=\"active\"", static_cast<double>(stats.upstreams.active));
+    sample(out, "vltrig_upstreams", "state=\"sleep\"", static_cast<double>(stats.upstreams.sleep));
+    sample(out, "vltrig_upstreams", "state=\"error\"", static_cast<double>(stats.upstreams.error));
+
+    family(out, "vltrig_share_latency_ms", "summary", "Pool round trip of accepted shares in milliseconds.");
+    summary(out, "vltrig_share_latency_ms", nullptr, stats.latency.total());
+
+    std::string url;
+    for (const auto &kv : stats.upstreamLatency) {
+        url = "url=\"";
+        escape(url, kv.first.c_str());
+        url += "\"";
+
+        summary(out, "vltrig_share_latency_ms", url.c_str(), kv.second.total());
+    }
+
+    family(out, "vltrig_first_job_us", "summary", "Time from miner login to its first job in microseconds.");
+    summary(out, "vltrig_first_job_us", nullptr, Counters::firstJob);
+
+    family(out, "vltrig_failover_ms", "summary", "Gap between losing the active pool and the next pool taking over in milliseconds.");
+    summary(out, "vltrig_failover_ms", nullptr, Counters::failover);
+
+    family(out, "vltrig_loop_lag_ms", "summary", "Event loop lag sampled every 10 ms in milliseconds.");
+    summary(out, "vltrig_loop_lag_ms", nullptr, Counters::loopLag);
+
+    family(out, "vltrig_loop_stalls", "counter", "Event loop iterations blocked for 50 ms or more, by source.");
+    for (size_t i = 0; i < LoopMonitor::SourceMax; ++i) {
+        const auto source = static_cast<LoopMonitor::Source>(i);
+
+        snprintf(labels, sizeof(labels), "source=\"%s\"", LoopMonitor::name(source));
+        sample(out, "vltrig_loop_stalls_total", labels, static_cast<double>(LoopMonitor::stalls(source)));
+    }
+
+    gauge(out, "vltrig_event_queue_depth", "Log records waiting for the background event thread.", static_cast<double>(proxy->events().depth()));
+    counter(out, "vltrig_event_queue_dropped", "Log records dropped because the event queue was full.", proxy->events().dropped());
+
+    family(out, "vltrig_dns_lookups", "counter", "Name lookups by cache result.");
+    sample(out, "vltrig_dns_lookups_total", "result=\"hit\"", static_cast<double>(Dns::hits()));
+    sample(out, "vltrig_dns_lookups_total", "result=\"miss\"", static_cast<double>(Dns::misses()));
+    sample(out, "vltrig_dns_lookups_total", "result=\"stale\"", static_cast<double>(Dns::stale()));
+    counter(out, "vltrig_dns_prefetches", "Cached names refreshed in the background before they expired.", Dns::prefetches());
+
+#   ifdef XMRIG_FEATURE_PROFILING
+    family(out, "vltrig_share_stage_us", "summary", "Share latency by processing stage in microseconds.");
+    for (size_t i = 0; i < Profiler::StageMax; ++i) {
+        const auto stage = static_cast<Profiler::Stage>(i);
+
+        snprintf(labels, sizeof(labels), "stage=\"%s\"", Profiler::name(stage));
+        summary(out, "vltrig_share_stage_us", labels, Profiler::stage(stage));
+    }
+#   endif
+}
+
+
+void xmrig::Metrics::counter(std::string &out, const char *name, const char *help, uint64_t value)
+{
+    family(out, name, "counter", help);
+
+    char buf[160];
+    snprintf(buf, sizeof(buf), "%s_total %" PRIu64 "\n", name, value);
+    out += buf;
+}
+
+
+void xmrig::Metrics::family(std::string &out, const char *name, const char *type, const char *help)
+{
+    out += "# TYPE ";
+    out += name;
+    out += ' ';
+    out += type;
+    out += "\n# HELP ";
+    out += name;
+    out += ' ';
+    out += help;
+    out += '\n';
+}
+
+
+void xmrig::Metrics::gauge(std::string &out, const char *name, const char *help, double value)
+{
+    family(out, name, "gauge", help);
+    sample(out, name, nullptr, value);
+}
+
+
+void xmrig::Metrics::sample(std::string &out, const char *name, const char *labels, double value)
+{
+    out += name;
+
+    if (labels && *labels) {
+        out += '{';
+        out += labels;
+        out += '}';
+    }
+
+    char buf[32];
+    snprintf(buf, sizeof(buf), " %.17g\n", value);
+    out += buf;
+}
+
+
+void xmrig::Metrics::summary(std::string &out, const char *name, const char *labels, const Histogram &histogram)
+{
+    static const char *quantiles[] = { "0.5", "0.9", "0.99" };
+    static const double values[]   = { 0.5, 0.9, 0.99 };
+
+    std::string tags;
+    char suffix[96];
+
+    for (size_t i = 0; i < 3; ++i) {
+        tags = labels ? labels : "";
+        tags += tags.empty() ? "quantile=\"" : ",quantile=\"";
+        tags += quantiles[i];
+        tags += '"';
+
+        sample(out, name, tags.c_str(), static_cast<double>(histogram.quantile(values[i])));
+    }
+
+    snprintf(suffix, sizeof(suffix), "%s_sum", name);
+    sample(out, suffix, labels, static_cast<double>(histogram.sum()));
+
+    snprintf(suffix, sizeof(suffix), "%s_count", name);
+    sample(out, suffix, labels, static_cast<double>(histogram.count()));
+}
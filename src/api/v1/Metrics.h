@@ -0,0 +1,61 @@
+/* XMRig
+ * Copyright (c) 2026      HashVault   <https://github.com/HashVault>, <root@hashvault.pro>
+ *
+ *   This program is free software: you can redistribute it and/or modify
+ *   it under the terms of the GNU General Public License as published by
+ *   the Free Software Foundation, either version 3 of the License, or
+ *   (at your option) any later version.
+ *
+ *   This program is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ *   GNU General Public License for more details.
+ *
+ *   You should have received a copy of the GNU General Public License
+ *   along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef XMRIG_METRICS_H
+#define XMRIG_METRICS_H
+
+
+#include "base/api/interfaces/IMetricsListener.h"
+
+
+namespace xmrig {
+
+
+class Controller;
+class Histogram;
+
+
+/**
+ * OpenMetrics text exposition for /metrics, written straight into the caller's buffer from
+ * the existing counters, no JSON document is built.
+ */
+class Metrics : public IMetricsListener
+{
+public:
+    XMRIG_DISABLE_COPY_MOVE_DEFAULT(Metrics)
+
+    Metrics(Controller *controller);
+    ~Metrics() override = default;
+
+protected:
+    void onMetrics(std::string &out) override;
+
+private:
+    static void counter(std::string &out, const char *name, const char *help, uint64_t value);
+    static void family(std::string &out, const char *name, const char *type, const char *help);
+    static void gauge(std::string &out, const char *name, const char *help, double value);
+    static void sample(std::string &out, const char *name, const char *labels, double value);
+    static void summary(std::string &out, const char *name, const char *labels, const Histogram &histogram);
+
+    Controller *m_controller;
+};
+
+
+} /* namespace xmrig */
+
+
+#endif /* XMRIG_METRICS_H */
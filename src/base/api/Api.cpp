@@ -20,8 +20,13 @@
 
 
 #include "base/api/Api.h"
+#include "3rdparty/rapidjson/stringbuffer.h"
 #include "3rdparty/rapidjson/writer.h"
 #include "base/api/interfaces/IApiListener.h"
+#include "base/api/interfaces/IApiPushListener.h"
+#include "base/api/interfaces/IApiStreamListener.h"
+#include "base/api/interfaces/IMetricsListener.h"
+#include "base/api/requests/ApiRequest.h"
 #include "base/api/requests/HttpApiRequest.h"
 #include "base/crypto/keccak.h"
 #include "base/io/Env.h"
@@ -29,6 +34,11 @@
 #include "base/io/log/Log.h"
 #include "base/io/log/Tags.h"
 #include "base/kernel/Base.h"
+#include "base/net/http/HttpChunkedStream.h"
+#include "base/net/http/HttpContext.h"
+#include "base/net/http/HttpData.h"
+#include "base/net/http/HttpQuery.h"
+#include "base/net/http/HttpResponse.h"
 #include "base/tools/Chrono.h"
 #include "base/tools/Cvt.h"
 #include "core/config/Config.h"
@@ -52,6 +62,73 @@ static_assert(
     );
 
 
+// the summary rendered once per tick for push subscribers, no HTTP request behind it.
+class PushApiRequest : public ApiRequest
+{
+public:
+    inline PushApiRequest(rapidjson::Document &doc, bool restricted) : ApiRequest(SOURCE_HTTP, restricted), m_doc(doc), m_url("/1/summary") { m_type = REQ_SUMMARY; }
+
+protected:
+    inline bool hasParseError() const override                  { return false; }
+    inline const rapidjson::Value &json() const override         { return m_json; }
+    inline const String &url() const override                    { return m_url; }
+    inline Method method() const override                        { return METHOD_GET; }
+    inline rapidjson::Document &doc() override                   { return m_doc; }
+    inline rapidjson::Value &reply() override                    { return m_doc; }
+    inline void setRpcError(int, const char *) override          {}
+    inline void setRpcResult(rapidjson::Value &) override        {}
+
+private:
+    rapidjson::Document &m_doc;
+    rapidjson::Value m_json;
+    String m_url;
+};
+
+
+// JSON merge patch (RFC 7386) turning prev into next, members that did not change are left out.
+static void diff(const rapidjson::Value &prev, const rapidjson::Value &next, rapidjson::Value &patch, rapidjson::Document &doc)
+{
+    using namespace rapidjson;
+    auto &allocator = doc.GetAllocator();
+
+    for (auto &member : next.GetObject()) {
+        auto it = prev.FindMember(member.name);
+
+        if (it == prev.MemberEnd() || (!member.value.IsObject() && it->value != member.value) || (member.value.IsObject() && !it->value.IsObject())) {
+            patch.AddMember(Value(member.name, allocator), Value(member.value, allocator), allocator);
+        }
+        else if (member.value.IsObject()) {
+            Value child(kObjectType);
+            diff(it->value, member.value, child, doc);
+
+            if (!child.ObjectEmpty()) {
+                patch.AddMember(Value(member.name, allocator), child, allocator);
+            }
+        }
+    }
+
+    for (auto &member : prev.GetObject()) {
+        if (!next.HasMember(member.name)) {
+            patch.AddMember(Value(member.name, allocator), Value(kNullType), allocator);
+        }
+    }
+}
+
+
+static void appendEvent(std::string &out, const char *event, const rapidjson::Value &data)
+{
+    rapidjson::StringBuffer buffer(nullptr, 4096);
+    rapidjson::Writer<rapidjson::StringBuffer> writer(buffer);
+    data.Accept(writer);
+
+    out += "event: ";
+    out += event;
+    out += "\ndata: ";
+    out.append(buffer.GetString(), buffer.GetSize());
+    out += "\n\n";
+}
+
+
 static rapidjson::Value getResources(rapidjson::Document &doc)
 {
     using namespace rapidjson;
@@ -108,6 +185,93 @@ xmrig::Api::~Api()
 }
 
 
+void xmrig::Api::metrics(const HttpData &req)
+{
+    if (!m_metrics) {
+        return HttpResponse(req.id(), 404 /* NOT_FOUND */).end();
+    }
+
+    // the buffer keeps its capacity between scrapes, so steady state rendering does not allocate.
+    m_buffer.clear();
+    m_metrics->onMetrics(m_buffer);
+    m_buffer += "# EOF\n";
+
+    HttpResponse response(req.id());
+    response.setHeader(HttpData::kContentType, "application/openmetrics-text; version=1.0.0; charset=utf-8");
+    response.end(m_buffer.data(), m_buffer.size());
+}
+
+
+bool xmrig::Api::stream(const HttpData &req)
+{
+    if (!m_stream) {
+        return false;
+    }
+
+    HttpResponse response(req.id());
+    response.setHeader("Access-Control-Allow-Origin", "*");
+    response.setHeader(HttpData::kContentType, HttpData::kApplicationJson);
+
+    HttpChunkedStream out(response);
+    if (!m_stream->onStream(HttpQuery(req.url), out)) {
+        return false;
+    }
+
+    out.end();
+
+    return true;
+}
+
+
+void xmrig::Api::push()
+{
+    using namespace rapidjson;
+
+    if (m_subscribers.empty() && m_pending.empty()) {
+        m_summary.SetNull();
+
+        return;
+    }
+
+    Document summary(kObjectType);
+    PushApiRequest request(summary, m_base->config()->http().isRestricted());
+    exec(request);
+
+    std::string frames;
+
+    if (!m_subscribers.empty()) {
+        Value patch(kObjectType);
+        diff(m_summary, summary, patch, summary);
+
+        if (!patch.ObjectEmpty()) {
+            appendEvent(frames, "summary", patch);
+        }
+
+        if (m_push) {
+            m_push->onPush(frames, false);
+        }
+
+        send(m_subscribers, frames.empty() ? ":\n\n" : frames);
+    }
+
+    m_summary.Swap(summary);
+
+    // new subscribers start from the state the others have just been brought to.
+    if (!m_pending.empty()) {
+        frames.clear();
+        appendEvent(frames, "summary", m_summary);
+
+        if (m_push) {
+            m_push->onPush(frames, true);
+        }
+
+        send(m_pending, frames);
+        m_subscribers.insert(m_subscribers.end(), m_pending.begin(), m_pending.end());
+        m_pending.clear();
+    }
+}
+
+
 void xmrig::Api::request(const HttpData &req)
 {
     HttpApiRequest request(req, m_base->config()->http().isRestricted());
@@ -161,6 +325,18 @@ void xmrig::Api::tick()
 }
 
 
+void xmrig::Api::subscribe(const HttpData &req)
+{
+    HttpResponse response(req.id());
+    response.setHeader("Access-Control-Allow-Origin", "*");
+    response.setHeader("Cache-Control", "no-cache");
+    response.setHeader(HttpData::kContentType, "text/event-stream");
+    response.begin();
+
+    m_pending.push_back(req.id());
+}
+
+
 void xmrig::Api::onConfigChanged(Config *config, Config *previousConfig)
 {
     if (config->apiId() != previousConfig->apiId()) {
@@ -227,6 +403,29 @@ void xmrig::Api::exec(IApiRequest &request)
 }
 
 
+void xmrig::Api::send(std::vector<uint64_t> &subscribers, const std::string &frames)
+{
+    auto it = subscribers.begin();
+
+    while (it != subscribers.end()) {
+        auto ctx = HttpContext::get(*it);
+
+        // a closed tab or a reader that stopped draining its socket is dropped.
+        if (!ctx || !uv_is_writable(ctx->stream()) || uv_stream_get_write_queue_size(ctx->stream()) > kMaxPushQueue) {
+            if (ctx) {
+                ctx->close();
+            }
+
+            it = subscribers.erase(it);
+            continue;
+        }
+
+        ctx->write(std::string(frames), false);
+        ++it;
+    }
+}
+
+
 void xmrig::Api::genId(const String &id)
 {
     memset(m_id, 0, sizeof(m_id));
@@ -20,9 +20,11 @@
 #define XMRIG_API_H
 
 
+#include <string>
 #include <vector>
 
 
+#include "3rdparty/rapidjson/document.h"
 #include "base/kernel/interfaces/IBaseListener.h"
 #include "base/tools/String.h"
 
@@ -34,7 +36,10 @@ class Base;
 class Httpd;
 class HttpData;
 class IApiListener;
+class IApiPushListener;
 class IApiRequest;
+class IApiStreamListener;
+class IMetricsListener;
 class String;
 
 
@@ -49,25 +54,42 @@ public:
     inline const char *id() const                   { return m_id; }
     inline const char *workerId() const             { return m_workerId; }
     inline void addListener(IApiListener *listener) { m_listeners.push_back(listener); }
+    inline void setMetrics(IMetricsListener *metrics) { m_metrics = metrics; }
+    inline void setPush(IApiPushListener *push)       { m_push = push; }
+    inline void setStream(IApiStreamListener *stream) { m_stream = stream; }
 
+    bool stream(const HttpData &req);
+    void metrics(const HttpData &req);
+    void push();
     void request(const HttpData &req);
     void start();
     void stop();
+    void subscribe(const HttpData &req);
     void tick();
 
 protected:
     void onConfigChanged(Config *config, Config *previousConfig) override;
 
 private:
+    constexpr static size_t kMaxPushQueue = 1024 * 1024;
+
     void exec(IApiRequest &request);
     void genId(const String &id);
     void genWorkerId(const String &id);
+    void send(std::vector<uint64_t> &subscribers, const std::string &frames);
 
     Base *m_base;
     char m_id[32]{};
     const uint64_t m_timestamp;
     Httpd *m_httpd  = nullptr;
+    IApiPushListener *m_push    = nullptr;
+    IApiStreamListener *m_stream = nullptr;
+    IMetricsListener *m_metrics = nullptr;
+    rapidjson::Document m_summary;
+    std::string m_buffer;
     std::vector<IApiListener *> m_listeners;
+    std::vector<uint64_t> m_pending;
+    std::vector<uint64_t> m_subscribers;
     String m_workerId;
     uint8_t m_ticks = 0;
 };
@@ -180,6 +180,18 @@ void xmrig::Httpd::onHttpData(const HttpData &data)
         return HttpApiResponse(data.id(), status).end();
     }
 
+    if (data.method == HTTP_GET && data.url == "/metrics") {
+        return m_base->api()->metrics(data);
+    }
+
+    if (data.method == HTTP_GET && data.url == "/1/events") {
+        return m_base->api()->subscribe(data);
+    }
+
+    if (data.method == HTTP_GET && m_base->api()->stream(data)) {
+        return;
+    }
+
     if (data.method != HTTP_GET) {
         if (m_base->config()->http().isRestricted()) {
             return HttpApiResponse(data.id(), 403 /* FORBIDDEN */).end();
@@ -0,0 +1,47 @@
+/* XMRig
+ * Copyright (c) 2026      HashVault   <https://github.com/HashVault>, <root@hashvault.pro>
+ *
+ *   This program is free software: you can redistribute it and/or modify
+ *   it under the terms of the GNU General Public License as published by
+ *   the Free Software Foundation, either version 3 of the License, or
+ *   (at your option) any later version.
+ *
+ *   This program is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ *   GNU General Public License for more details.
+ *
+ *   You should have received a copy of the GNU General Public License
+ *   along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef XMRIG_IAPIPUSHLISTENER_H
+#define XMRIG_IAPIPUSHLISTENER_H
+
+
+#include <string>
+
+
+#include "base/tools/Object.h"
+
+
+namespace xmrig {
+
+
+class IApiPushListener
+{
+public:
+    XMRIG_DISABLE_COPY_MOVE(IApiPushListener)
+
+    IApiPushListener()          = default;
+    virtual ~IApiPushListener() = default;
+
+    // appends server-sent event frames: changes since the previous non-full call, or the whole state if full is set.
+    virtual void onPush(std::string &out, bool full) = 0;
+};
+
+
+} /* namespace xmrig */
+
+
+#endif // XMRIG_IAPIPUSHLISTENER_H
@@ -0,0 +1,48 @@
+/* XMRig
+ * Copyright (c) 2026      HashVault   <https://github.com/HashVault>, <root@hashvault.pro>
+ *
+ *   This program is free software: you can redistribute it and/or modify
+ *   it under the terms of the GNU General Public License as published by
+ *   the Free Software Foundation, either version 3 of the License, or
+ *   (at your option) any later version.
+ *
+ *   This program is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ *   GNU General Public License for more details.
+ *
+ *   You should have received a copy of the GNU General Public License
+ *   along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef XMRIG_IAPISTREAMLISTENER_H
+#define XMRIG_IAPISTREAMLISTENER_H
+
+
+#include "base/tools/Object.h"
+
+
+namespace xmrig {
+
+
+class HttpChunkedStream;
+class HttpQuery;
+
+
+class IApiStreamListener
+{
+public:
+    XMRIG_DISABLE_COPY_MOVE(IApiStreamListener)
+
+    IApiStreamListener()          = default;
+    virtual ~IApiStreamListener() = default;
+
+    // writes the JSON body of a GET request straight to the socket, returns false before writing anything if the path is not a streamed one.
+    virtual bool onStream(const HttpQuery &query, HttpChunkedStream &out) = 0;
+};
+
+
+} /* namespace xmrig */
+
+
+#endif // XMRIG_IAPISTREAMLISTENER_H
@@ -0,0 +1,47 @@
+/* XMRig
+ * Copyright (c) 2026      HashVault   <https://github.com/HashVault>, <root@hashvault.pro>
+ *
+ *   This program is free software: you can redistribute it and/or modify
+ *   it under the terms of the GNU General Public License as published by
+ *   the Free Software Foundation, either version 3 of the License, or
+ *   (at your option) any later version.
+ *
+ *   This program is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ *   GNU General Public License for more details.
+ *
+ *   You should have received a copy of the GNU General Public License
+ *   along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef XMRIG_IMETRICSLISTENER_H
+#define XMRIG_IMETRICSLISTENER_H
+
+
+#include <string>
+
+
+#include "base/tools/Object.h"
+
+
+namespace xmrig {
+
+
+class IMetricsListener
+{
+public:
+    XMRIG_DISABLE_COPY_MOVE(IMetricsListener)
+
+    IMetricsListener()          = default;
+    virtual ~IMetricsListener() = default;
+
+    // appends the OpenMetrics text exposition, without the trailing "# EOF" line.
+    virtual void onMetrics(std::string &out) = 0;
+};
+
+
+} /* namespace xmrig */
+
+
+#endif // XMRIG_IMETRICSLISTENER_H
@@ -15,7 +15,9 @@ set(HEADERS_BASE
     src/base/io/log/backends/FileLog.h
     src/base/io/log/FileLogWriter.h
     src/base/io/log/Log.h
+    src/base/io/log/LogRotation.h
     src/base/io/log/Tags.h
+    src/base/io/MappedFile.h
     src/base/io/Signals.h
     src/base/io/Watcher.h
     src/base/kernel/Base.h
@@ -44,6 +46,7 @@ set(HEADERS_BASE
     src/base/kernel/Platform.h
     src/base/kernel/Process.h
     src/base/net/dns/Dns.h
+    src/base/net/dns/DnsCacheFile.h
     src/base/net/dns/DnsConfig.h
     src/base/net/dns/DnsRecord.h
     src/base/net/dns/DnsRecords.h
@@ -103,6 +106,7 @@ set(SOURCES_BASE
     src/base/io/log/backends/FileLog.cpp
     src/base/io/log/FileLogWriter.cpp
     src/base/io/log/Log.cpp
+    src/base/io/log/LogRotation.cpp
     src/base/io/log/Tags.cpp
     src/base/io/Signals.cpp
     src/base/io/Watcher.cpp
@@ -114,6 +118,7 @@ set(SOURCES_BASE
     src/base/kernel/Platform.cpp
     src/base/kernel/Process.cpp
     src/base/net/dns/Dns.cpp
+    src/base/net/dns/DnsCacheFile.cpp
     src/base/net/dns/DnsConfig.cpp
     src/base/net/dns/DnsRecord.cpp
     src/base/net/dns/DnsRecords.cpp
@@ -148,18 +153,21 @@ set(SOURCES_BASE
 if (WIN32)
     set(SOURCES_OS
         src/base/io/json/Json_win.cpp
+        src/base/io/MappedFile_win.cpp
         src/base/kernel/Platform_win.cpp
         src/base/kernel/Process_win.cpp
         )
 elseif (APPLE)
     set(SOURCES_OS
         src/base/io/json/Json_unix.cpp
+        src/base/io/MappedFile_unix.cpp
         src/base/kernel/Platform_mac.cpp
         src/base/kernel/Process_unix.cpp
         )
 else()
     set(SOURCES_OS
         src/base/io/json/Json_unix.cpp
+        src/base/io/MappedFile_unix.cpp
         src/base/kernel/Platform_unix.cpp
         src/base/kernel/Process_unix.cpp
         )
@@ -187,7 +195,10 @@ if (WITH_HTTP)
         src/3rdparty/llhttp/llhttp.h
         src/base/api/Api.h
         src/base/api/Httpd.h
+        src/base/api/interfaces/IApiPushListener.h
         src/base/api/interfaces/IApiRequest.h
+        src/base/api/interfaces/IApiStreamListener.h
+        src/base/api/interfaces/IMetricsListener.h
         src/base/api/requests/ApiRequest.h
         src/base/api/requests/HttpApiRequest.h
         src/base/kernel/interfaces/IHttpListener.h
@@ -195,9 +206,11 @@ if (WITH_HTTP)
         src/base/kernel/interfaces/ITcpServerListener.h
         src/base/net/http/Fetch.h
         src/base/net/http/HttpApiResponse.h
+        src/base/net/http/HttpChunkedStream.h
         src/base/net/http/HttpClient.h
         src/base/net/http/HttpContext.h
         src/base/net/http/HttpData.h
+        src/base/net/http/HttpQuery.h
         src/base/net/http/HttpResponse.h
         src/base/net/stratum/DaemonClient.h
         src/base/net/stratum/SelfSelectClient.h
@@ -214,9 +227,11 @@ if (WITH_HTTP)
         src/base/api/requests/HttpApiRequest.cpp
         src/base/net/http/Fetch.cpp
         src/base/net/http/HttpApiResponse.cpp
+        src/base/net/http/HttpChunkedStream.cpp
         src/base/net/http/HttpClient.cpp
         src/base/net/http/HttpContext.cpp
         src/base/net/http/HttpData.cpp
+        src/base/net/http/HttpQuery.cpp
         src/base/net/http/HttpListener.cpp
         src/base/net/http/HttpResponse.cpp
         src/base/net/stratum/DaemonClient.cpp
@@ -0,0 +1,75 @@
+/* XMRig
+ * Copyright (c) 2026      HashVault   <https://github.com/HashVault>, <root@hashvault.pro>
+ *
+ *   This program is free software: you can redistribute it and/or modify
+ *   it under the terms of the GNU General Public License as published by
+ *   the Free Software Foundation, either version 3 of the License, or
+ *   (at your option) any later version.
+ *
+ *   This program is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ *   GNU General Public License for more details.
+ *
+ *   You should have received a copy of the GNU General Public License
+ *   along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef XMRIG_MAPPEDFILE_H
+#define XMRIG_MAPPEDFILE_H
+
+
+#include <cstddef>
+#include <cstdint>
+
+
+#include "base/tools/Object.h"
+#include "base/tools/String.h"
+
+
+namespace xmrig {
+
+
+/**
+ * Read-write shared mapping of a whole file, writes land in the page cache and reach the disk
+ * in the background, so updating it costs a memcpy instead of a serialization pass.
+ */
+class MappedFile
+{
+public:
+    XMRIG_DISABLE_COPY_MOVE(MappedFile)
+
+    MappedFile() = default;
+    inline ~MappedFile()                    { close(); }
+
+    inline bool isOpen() const              { return m_data != nullptr; }
+    inline const String &path() const       { return m_path; }
+    inline size_t size() const              { return m_size; }
+    inline uint8_t *data() const            { return m_data; }
+
+    bool open(const char *path, size_t size);
+    bool resize(size_t size);
+    void close();
+    void flush();
+
+private:
+    bool map(size_t size);
+    void unmap();
+
+    String m_path;
+    size_t m_size   = 0;
+    uint8_t *m_data = nullptr;
+
+#   ifdef _WIN32
+    void *m_file    = nullptr;
+    void *m_mapping = nullptr;
+#   else
+    int m_fd        = -1;
+#   endif
+};
+
+
+} /* namespace xmrig */
+
+
+#endif /* XMRIG_MAPPEDFILE_H */
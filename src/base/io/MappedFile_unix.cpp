@@ -0,0 +1,134 @@
+/* XMRig
+ * Copyright (c) 2026      HashVault   <https://github.com/HashVault>, <root@hashvault.pro>
+ *
+ *   This program is free software: you can redistribute it and/or modify
+ *   it under the terms of the GNU General Public License as published by
+ *   the Free Software Foundation, either version 3 of the License, or
+ *   (at your option) any later version.
+ *
+ *   This program is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ *   GNU General Public License for more details.
+ *
+ *   You should have received a copy of the GNU General Public License
+ *   along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#include <cerrno>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+
+#include "base/io/MappedFile.h"
+
+
+namespace xmrig {
+
+
+// a sparse file gets its blocks on first write, through a mapping a full disk is SIGBUS instead of an error.
+static bool reserve(int fd, size_t size)
+{
+#   ifdef __APPLE__
+    fstore_t store = { F_ALLOCATEALL, F_PEOFPOSMODE, 0, static_cast<off_t>(size), 0 };
+
+    return fcntl(fd, F_PREALLOCATE, &store) != -1 || errno == ENOTSUP;
+#   else
+    return posix_fallocate(fd, 0, static_cast<off_t>(size)) == 0;
+#   endif
+}
+
+
+} // namespace xmrig
+
+
+bool xmrig::MappedFile::open(const char *path, size_t size)
+{
+    close();
+
+    m_fd = ::open(path, O_RDWR | O_CREAT, 0644);
+    if (m_fd < 0) {
+        return false;
+    }
+
+    struct stat st{};
+    if (fstat(m_fd, &st) != 0) {
+        close();
+
+        return false;
+    }
+
+    m_path = path;
+
+    // an existing file is mapped whole, the caller decides if its content is usable.
+    if (!map(st.st_size > 0 ? static_cast<size_t>(st.st_size) : size)) {
+        close();
+
+        return false;
+    }
+
+    return true;
+}
+
+
+bool xmrig::MappedFile::resize(size_t size)
+{
+    if (m_fd < 0) {
+        return false;
+    }
+
+    unmap();
+
+    return map(size);
+}
+
+
+void xmrig::MappedFile::close()
+{
+    unmap();
+
+    if (m_fd >= 0) {
+        ::close(m_fd);
+        m_fd = -1;
+    }
+}
+
+
+void xmrig::MappedFile::flush()
+{
+    if (m_data) {
+        msync(m_data, m_size, MS_ASYNC);
+    }
+}
+
+
+bool xmrig::MappedFile::map(size_t size)
+{
+    if (size == 0 || ftruncate(m_fd, static_cast<off_t>(size)) != 0 || !reserve(m_fd, size)) {
+        return false;
+    }
+
+    void *data = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, m_fd, 0);
+    if (data == MAP_FAILED) {
+        return false;
+    }
+
+    m_data = static_cast<uint8_t *>(data);
+    m_size = size;
+
+    return true;
+}
+
+
+void xmrig::MappedFile::unmap()
+{
+    if (m_data) {
+        munmap(m_data, m_size);
+    }
+
+    m_data = nullptr;
+    m_size = 0;
+}
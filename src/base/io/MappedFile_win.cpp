@@ -0,0 +1,158 @@
+/* XMRig
+ * Copyright (c) 2026      HashVault   <https://github.com/HashVault>, <root@hashvault.pro>
+ *
+ *   This program is free software: you can redistribute it and/or modify
+ *   it under the terms of the GNU General Public License as published by
+ *   the Free Software Foundation, either version 3 of the License, or
+ *   (at your option) any later version.
+ *
+ *   This program is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ *   GNU General Public License for more details.
+ *
+ *   You should have received a copy of the GNU General Public License
+ *   along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#include <windows.h>
+
+
+#include <cstring>
+#include <string>
+
+
+#include "base/io/MappedFile.h"
+
+
+namespace xmrig {
+
+
+static std::wstring toUtf16(const char *str)
+{
+    const int size = static_cast<int>(strlen(str));
+    std::wstring ret;
+
+    int len = MultiByteToWideChar(CP_UTF8, 0, str, size, nullptr, 0);
+    if (len > 0) {
+        ret.resize(static_cast<size_t>(len));
+        MultiByteToWideChar(CP_UTF8, 0, str, size, &ret[0], len);
+    }
+
+    return ret;
+}
+
+
+} // namespace xmrig
+
+
+bool xmrig::MappedFile::open(const char *path, size_t size)
+{
+    close();
+
+    HANDLE file = CreateFileW(toUtf16(path).c_str(), GENERIC_READ | GENERIC_WRITE, FILE_SHARE_READ, nullptr, OPEN_ALWAYS, FILE_ATTRIBUTE_NORMAL, nullptr);
+    if (file == INVALID_HANDLE_VALUE) {
+        return false;
+    }
+
+    m_file = file;
+    m_path = path;
+
+    LARGE_INTEGER current{};
+    if (!GetFileSizeEx(file, &current)) {
+        close();
+
+        return false;
+    }
+
+    // an existing file is mapped whole, the caller decides if its content is usable.
+    if (!map(current.QuadPart > 0 ? static_cast<size_t>(current.QuadPart) : size)) {
+        close();
+
+        return false;
+    }
+
+    return true;
+}
+
+
+bool xmrig::MappedFile::resize(size_t size)
+{
+    if (!m_file) {
+        return false;
+    }
+
+    unmap();
+
+    return map(size);
+}
+
+
+void xmrig::MappedFile::close()
+{
+    unmap();
+
+    if (m_file) {
+        CloseHandle(static_cast<HANDLE>(m_file));
+        m_file = nullptr;
+    }
+}
+
+
+void xmrig::MappedFile::flush()
+{
+    if (m_data) {
+        FlushViewOfFile(m_data, 0);
+    }
+}
+
+
+bool xmrig::MappedFile::map(size_t size)
+{
+    if (size == 0) {
+        return false;
+    }
+
+    LARGE_INTEGER length{};
+    length.QuadPart = static_cast<LONGLONG>(size);
+
+    // the file is not sparse, SetEndOfFile allocates every cluster up front and fails on a full disk.
+    if (!SetFilePointerEx(static_cast<HANDLE>(m_file), length, nullptr, FILE_BEGIN) || !SetEndOfFile(static_cast<HANDLE>(m_file))) {
+        return false;
+    }
+
+    HANDLE mapping = CreateFileMappingW(static_cast<HANDLE>(m_file), nullptr, PAGE_READWRITE, length.HighPart, length.LowPart, nullptr);
+    if (!mapping) {
+        return false;
+    }
+
+    void *data = MapViewOfFile(mapping, FILE_MAP_ALL_ACCESS, 0, 0, size);
+    if (!data) {
+        CloseHandle(mapping);
+
+        return false;
+    }
+
+    m_mapping = mapping;
+    m_data    = static_cast<uint8_t *>(data);
+    m_size    = size;
+
+    return true;
+}
+
+
+void xmrig::MappedFile::unmap()
+{
+    if (m_data) {
+        UnmapViewOfFile(m_data);
+    }
+
+    if (m_mapping) {
+        CloseHandle(static_cast<HANDLE>(m_mapping));
+    }
+
+    m_mapping = nullptr;
+    m_data    = nullptr;
+    m_size    = 0;
+}
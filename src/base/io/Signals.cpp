@@ -63,7 +63,11 @@ void xmrig::Signals::onSignal(uv_signal_t *handle, int signum)
     switch (signum)
     {
     case SIGHUP:
+#       ifdef XMRIG_OS_WIN
         LOG_WARN("%s " YELLOW("SIGHUP received, exiting"), Tags::signal());
+#       else
+        LOG_NOTICE("%s " WHITE_BOLD("SIGHUP received, reopening log files"), Tags::signal());
+#       endif
         break;
 
     case SIGTERM:
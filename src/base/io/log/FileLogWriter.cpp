@@ -19,20 +19,148 @@
 
 #include "base/io/log/FileLogWriter.h"
 #include "base/io/Env.h"
+#include "base/tools/Chrono.h"
 
 
+#include <algorithm>
 #include <cassert>
+#include <cctype>
+#include <cinttypes>
+#include <cstdio>
+#include <cstring>
+#include <ctime>
+#include <mutex>
+
+
+#ifdef XMRIG_FEATURE_ZLIB
+#   include <zlib.h>
+#endif
 
 
 namespace xmrig {
 
 
-static void fsWriteCallback(uv_fs_t *req)
+static LogRotation rotationConfig;
+static std::mutex writersMutex;
+static std::vector<FileLogWriter *> writers;
+
+
+static int64_t writeAll(int file, const char *data, size_t size, int64_t pos)
 {
-    delete [] static_cast<char *>(req->data);
+    while (size > 0) {
+        uv_fs_t req{};
+        uv_buf_t buf = uv_buf_init(const_cast<char *>(data), static_cast<unsigned int>(size));
+
+        const int rc = uv_fs_write(uv_default_loop(), &req, file, &buf, 1, pos, nullptr);
+        uv_fs_req_cleanup(&req);
 
-    uv_fs_req_cleanup(req);
-    delete req;
+        if (rc <= 0) {
+            break;
+        }
+
+        data += rc;
+        size -= static_cast<size_t>(rc);
+        pos  += rc;
+    }
+
+    return pos;
+}
+
+
+static bool exists(const std::string &path)
+{
+    uv_fs_t req{};
+    const int rc = uv_fs_stat(uv_default_loop(), &req, path.c_str(), nullptr);
+    uv_fs_req_cleanup(&req);
+
+    return rc == 0;
+}
+
+
+#ifdef XMRIG_FEATURE_ZLIB
+static bool compress(const std::string &file)
+{
+    FILE *in = fopen(file.c_str(), "rb");
+    if (!in) {
+        return false;
+    }
+
+    const std::string out = file + ".gz";
+    gzFile gz = gzopen(out.c_str(), "wb6");
+    if (!gz) {
+        fclose(in);
+
+        return false;
+    }
+
+    std::vector<char> buf(256 * 1024);
+    bool ok     = true;
+    size_t size = 0;
+
+    while ((size = fread(buf.data(), 1, buf.size(), in)) > 0) {
+        if (gzwrite(gz, buf.data(), static_cast<unsigned int>(size)) != static_cast<int>(size)) {
+            ok = false;
+            break;
+        }
+    }
+
+    fclose(in);
+    ok = gzclose(gz) == Z_OK && ok;
+
+    remove(ok ? file.c_str() : out.c_str());
+
+    return ok;
+}
+#endif
+
+
+static inline std::string stem(const std::string &name)
+{
+    return name.size() > 3 && name.compare(name.size() - 3, 3, ".gz") == 0 ? name.substr(0, name.size() - 3) : name;
+}
+
+
+static void prune(const std::string &path, uint32_t keep)
+{
+    if (keep == 0) {
+        return;
+    }
+
+    const size_t slash     = path.find_last_of("/\\");
+    const std::string dir  = slash == std::string::npos ? "." : (slash == 0 ? "/" : path.substr(0, slash));
+    const std::string name = (slash == std::string::npos ? path : path.substr(slash + 1)) + ".";
+
+    uv_fs_t req{};
+    if (uv_fs_scandir(uv_default_loop(), &req, dir.c_str(), 0, nullptr) < 0) {
+        uv_fs_req_cleanup(&req);
+
+        return;
+    }
+
+    // only <name>.<timestamp>[.gz] is an archive, unrelated files next to the log are left alone.
+    std::vector<std::string> archives;
+    uv_dirent_t entry;
+
+    while (uv_fs_scandir_next(&req, &entry) != UV_EOF) {
+        if (strncmp(entry.name, name.c_str(), name.size()) == 0 && isdigit(static_cast<unsigned char>(entry.name[name.size()]))) {
+            archives.emplace_back(entry.name);
+        }
+    }
+
+    uv_fs_req_cleanup(&req);
+
+    if (archives.size() <= keep) {
+        return;
+    }
+
+    // compare without the .gz suffix, so name.<time> sorts before name.<time>-1 of the same second.
+    std::sort(archives.begin(), archives.end(), [](const std::string &a, const std::string &b) {
+        return stem(a) < stem(b);
+    });
+
+    for (size_t i = 0; i < archives.size() - keep; ++i) {
+        remove((dir + "/" + archives[i]).c_str());
+    }
 }
 
 
@@ -52,17 +180,46 @@ xmrig::FileLogWriter::FileLogWriter(const char* fileName)
 
 xmrig::FileLogWriter::~FileLogWriter()
 {
-    uv_close(reinterpret_cast<uv_handle_t*>(&m_flushAsync), nullptr);
+    if (m_started) {
+        {
+            std::lock_guard<std::mutex> lock(writersMutex);
+            writers.erase(std::remove(writers.begin(), writers.end(), this), writers.end());
+        }
+
+        uv_mutex_lock(&m_lock);
+        m_stop = true;
+        uv_cond_signal(&m_cond);
+        uv_mutex_unlock(&m_lock);
+
+        uv_thread_join(&m_thread);
+    }
+
+    // archives queued before the stop are still compressed and pruned.
+    if (m_archiving) {
+        uv_mutex_lock(&m_lock);
+        m_archiveStop = true;
+        uv_cond_signal(&m_archiveCond);
+        uv_mutex_unlock(&m_lock);
 
-    uv_mutex_destroy(&m_buffersLock);
+        uv_thread_join(&m_archiver);
+    }
+
+    if (isOpen()) {
+        uv_fs_t req{};
+        uv_fs_close(uv_default_loop(), &req, m_file, nullptr);
+        uv_fs_req_cleanup(&req);
+    }
+
+    uv_cond_destroy(&m_archiveCond);
+    uv_cond_destroy(&m_cond);
+    uv_mutex_destroy(&m_lock);
 }
 
 void xmrig::FileLogWriter::init()
 {
-    uv_mutex_init(&m_buffersLock);
-
-    uv_async_init(uv_default_loop(), &m_flushAsync, on_flush);
-    m_flushAsync.data = this;
+    uv_cond_init(&m_archiveCond);
+    uv_cond_init(&m_cond);
+    uv_mutex_init(&m_lock);
 }
 
 bool xmrig::FileLogWriter::open(const char *fileName)
@@ -72,81 +229,305 @@ bool xmrig::FileLogWriter::open(const char *fileName)
         return false;
     }
 
-    uv_fs_t req{};
-    const auto path = Env::expand(fileName);
-    m_file          = uv_fs_open(uv_default_loop(), &req, path, O_CREAT | O_WRONLY, 0644, nullptr);
-
-    if (req.result < 0 || !isOpen()) {
-        uv_fs_req_cleanup(&req);
-        m_file = -1;
+    m_path = Env::expand(fileName).data();
 
+    if (!reopenFile()) {
         return false;
     }
 
-    uv_fs_req_cleanup(&req);
+    if (!m_started) {
+        m_front.data.resize(kSegmentSize);
+        m_back.data.resize(kSegmentSize);
 
-    uv_fs_stat(uv_default_loop(), &req, path, nullptr);
-    m_pos = req.statbuf.st_size;
-    uv_fs_req_cleanup(&req);
+        {
+            std::lock_guard<std::mutex> lock(writersMutex);
+            writers.push_back(this);
+            m_rotation = rotationConfig;
+        }
+
+        schedule(m_rotation);
+
+        uv_thread_create(&m_thread, onThread, this);
+        m_started = true;
+    }
 
     return true;
 }
 
 
 bool xmrig::FileLogWriter::write(const char *data, size_t size)
+{
+    return append(data, size, false);
+}
+
+
+bool xmrig::FileLogWriter::writeLine(const char *data, size_t size)
+{
+    return append(data, size, true);
+}
+
+
+const xmrig::LogRotation &xmrig::FileLogWriter::rotation()
+{
+    return rotationConfig;
+}
+
+
+void xmrig::FileLogWriter::reopen()
+{
+    std::lock_guard<std::mutex> lock(writersMutex);
+
+    for (FileLogWriter *writer : writers) {
+        writer->m_reopen = true;
+
+        uv_mutex_lock(&writer->m_lock);
+        writer->m_signaled = true;
+        uv_cond_signal(&writer->m_cond);
+        uv_mutex_unlock(&writer->m_lock);
+    }
+}
+
+
+void xmrig::FileLogWriter::setRotation(const LogRotation &rotation)
+{
+    std::lock_guard<std::mutex> lock(writersMutex);
+    rotationConfig = rotation;
+
+    for (FileLogWriter *writer : writers) {
+        uv_mutex_lock(&writer->m_lock);
+        writer->m_rotation = rotation;
+        uv_mutex_unlock(&writer->m_lock);
+    }
+}
+
+
+bool xmrig::FileLogWriter::append(const char *data, size_t size, bool endl)
 {
     if (!isOpen()) {
         return false;
     }
 
-    uv_buf_t buf = uv_buf_init(new char[size], size);
-    memcpy(buf.base, data, size);
+    constexpr size_t N = sizeof(m_endl) - 1;
+    const size_t total = size + (endl ? N : 0);
+
+    uv_mutex_lock(&m_lock);
+
+    if (m_front.size + total > kSegmentSize) {
+        uv_mutex_unlock(&m_lock);
+        m_dropped++;
+
+        return false;
+    }
+
+    char *out = m_front.data.data() + m_front.size;
+    memcpy(out, data, size);
 
-    uv_mutex_lock(&m_buffersLock);
+    if (endl) {
+        memcpy(out + size, m_endl, N);
+    }
+
+    m_front.size += total;
 
-    m_buffers.emplace_back(buf);
-    uv_async_send(&m_flushAsync);
+    if (m_front.size >= kFlushThreshold && !m_signaled) {
+        m_signaled = true;
+        uv_cond_signal(&m_cond);
+    }
 
-    uv_mutex_unlock(&m_buffersLock);
+    uv_mutex_unlock(&m_lock);
 
     return true;
 }
 
 
-bool xmrig::FileLogWriter::writeLine(const char *data, size_t size)
+bool xmrig::FileLogWriter::reopenFile()
 {
-    if (!isOpen()) {
+    uv_fs_t req{};
+    const int file = uv_fs_open(uv_default_loop(), &req, m_path.c_str(), O_CREAT | O_WRONLY, 0644, nullptr);
+    uv_fs_req_cleanup(&req);
+
+    if (file < 0) {
         return false;
     }
 
-    constexpr size_t N = sizeof(m_endl) - 1;
+    uv_fs_fstat(uv_default_loop(), &req, file, nullptr);
+    m_pos = static_cast<int64_t>(req.statbuf.st_size);
+    uv_fs_req_cleanup(&req);
+
+    const int previous = m_file.exchange(file);
+    if (previous >= 0) {
+        uv_fs_close(uv_default_loop(), &req, previous, nullptr);
+        uv_fs_req_cleanup(&req);
+    }
+
+    return true;
+}
 
-    uv_buf_t buf = uv_buf_init(new char[size + N], size + N);
-    memcpy(buf.base, data, size);
-    memcpy(buf.base + size, m_endl, N);
 
-    uv_mutex_lock(&m_buffersLock);
+void xmrig::FileLogWriter::flush(const LogRotation &rotation)
+{
+    if (m_reopen.exchange(false)) {
+        reopenFile();
+    }
 
-    m_buffers.emplace_back(buf);
-    uv_async_send(&m_flushAsync);
+    // the interval is checked before the idle return, a quiet log is still rotated on time (an empty one is not).
+    if (rotation.isEnabled()) {
+        if (m_interval != rotation.interval()) {
+            schedule(rotation);
+        }
+
+        if (m_rotateAt && Chrono::currentMSecsSinceEpoch() >= m_rotateAt) {
+            if (m_pos > 0 || m_back.size > 0) {
+                rotate(rotation);
+            }
+            else {
+                schedule(rotation);
+            }
+        }
+    }
 
-    uv_mutex_unlock(&m_buffersLock);
+    const uint64_t dropped = m_dropped;
+    if (m_back.size == 0 && dropped == m_reported) {
+        return;
+    }
 
-    return true;
+    // another process truncated the file (logrotate copytruncate), carry on from its new end instead of leaving a hole.
+    uv_fs_t req{};
+    if (uv_fs_fstat(uv_default_loop(), &req, m_file, nullptr) == 0 && static_cast<int64_t>(req.statbuf.st_size) < m_pos) {
+        m_pos = static_cast<int64_t>(req.statbuf.st_size);
+    }
+
+    uv_fs_req_cleanup(&req);
+
+    if (rotation.isEnabled() && rotation.maxSize() && m_pos > 0 && static_cast<uint64_t>(m_pos) + m_back.size > rotation.maxSize()) {
+        rotate(rotation);
+    }
+
+    int64_t pos = writeAll(m_file, m_back.data.data(), m_back.size, m_pos);
+    m_back.size = 0;
+
+    if (dropped != m_reported) {
+        char notice[96];
+        const int size = snprintf(notice, sizeof(notice), "[log] %" PRIu64 " lines dropped, disk writes fell behind%s", dropped - m_reported, m_endl);
+
+        pos        = writeAll(m_file, notice, static_cast<size_t>(size), pos);
+        m_reported = dropped;
+    }
+
+    m_pos = pos;
+}
+
+
+void xmrig::FileLogWriter::rotate(const LogRotation &rotation)
+{
+    schedule(rotation);
+
+    const time_t now = time(nullptr);
+    tm stime{};
+
+#   ifdef _WIN32
+    localtime_s(&stime, &now);
+#   else
+    localtime_r(&now, &stime);
+#   endif
+
+    char suffix[32];
+    strftime(suffix, sizeof(suffix), ".%Y%m%d-%H%M%S", &stime);
+
+    std::string file = m_path + suffix;
+    for (int i = 1; exists(file) || exists(file + ".gz"); ++i) {
+        file = m_path + suffix + "-" + std::to_string(i);
+    }
+
+    // the open descriptor keeps writing to the renamed file until the new one is in place, no line is lost.
+    uv_fs_t req{};
+    const int rc = uv_fs_rename(uv_default_loop(), &req, m_path.c_str(), file.c_str(), nullptr);
+    uv_fs_req_cleanup(&req);
+
+    if (rc < 0 || !reopenFile()) {
+        return;
+    }
+
+    Archive archive;
+    archive.compress = rotation.isCompress();
+    archive.file     = file;
+    archive.path     = m_path;
+    archive.keep     = rotation.keep();
+
+    uv_mutex_lock(&m_lock);
+    m_archives.push_back(std::move(archive));
+    uv_cond_signal(&m_archiveCond);
+    uv_mutex_unlock(&m_lock);
+
+    if (!m_archiving) {
+        m_archiving = uv_thread_create(&m_archiver, onArchive, this) == 0;
+    }
+}
+
+
+void xmrig::FileLogWriter::run()
+{
+    uv_mutex_lock(&m_lock);
+
+    while (true) {
+        if (!m_stop && !m_signaled) {
+            uv_cond_timedwait(&m_cond, &m_lock, kFlushInterval * 1000000);
+        }
+
+        m_signaled = false;
+
+        const bool stop            = m_stop;
+        const LogRotation rotation = m_rotation;
+
+        std::swap(m_front, m_back);
+        uv_mutex_unlock(&m_lock);
+
+        const bool idle = m_back.size == 0;
+        flush(rotation);
+
+        if (stop && idle) {
+            break;
+        }
+
+        uv_mutex_lock(&m_lock);
+    }
 }
 
-void xmrig::FileLogWriter::flush()
+
+void xmrig::FileLogWriter::schedule(const LogRotation &rotation)
 {
-    uv_mutex_lock(&m_buffersLock);
+    // time based rotation happens on multiples of the interval since the epoch, daily rotation at UTC midnight.
+    m_interval = rotation.interval();
+    m_rotateAt = m_interval ? (Chrono::currentMSecsSinceEpoch() / m_interval + 1) * m_interval : 0;
+}
+
+
+void xmrig::FileLogWriter::archive()
+{
+    uv_mutex_lock(&m_lock);
+
+    while (true) {
+        while (m_archives.empty() && !m_archiveStop) {
+            uv_cond_wait(&m_archiveCond, &m_lock);
+        }
+
+        if (m_archives.empty()) {
+            break;
+        }
+
+        const Archive archive = std::move(m_archives.front());
+        m_archives.pop_front();
+        uv_mutex_unlock(&m_lock);
+
+#       ifdef XMRIG_FEATURE_ZLIB
+        if (archive.compress) {
+            compress(archive.file);
+        }
+#       endif
 
-    for (uv_buf_t buf : m_buffers) {
-        uv_fs_t* req = new uv_fs_t;
-        req->data = buf.base;
+        prune(archive.path, archive.keep);
 
-        uv_fs_write(uv_default_loop(), req, m_file, &buf, 1, m_pos, fsWriteCallback);
-        m_pos += buf.len;
+        uv_mutex_lock(&m_lock);
     }
-    m_buffers.clear();
 
-    uv_mutex_unlock(&m_buffersLock);
+    uv_mutex_unlock(&m_lock);
 }
@@ -20,30 +20,55 @@
 #define XMRIG_FILELOGWRITER_H
 
 
+#include <atomic>
 #include <cstddef>
 #include <cstdint>
-#include <vector>
+#include <deque>
+#include <string>
 #include <uv.h>
+#include <vector>
+
+
+#include "base/io/log/LogRotation.h"
 
 
 namespace xmrig {
 
 
+/**
+ * Lines are appended to a preallocated front segment under a short lock, a background thread
+ * swaps it with the back segment and writes it in one call every kFlushInterval or as soon as
+ * kFlushThreshold bytes are pending. Memory is fixed at two segments, lines that do not fit
+ * while the disk is behind are dropped and counted.
+ *
+ * Reopen after SIGHUP and size/time rotation run on the same thread between two writes, old
+ * files are renamed aside and queued to a helper thread that compresses and prunes them, so a slow
+ * gzip never holds up the writes.
+ */
 class FileLogWriter
 {
 public:
+    constexpr static size_t kSegmentSize     = 512 * 1024;
+    constexpr static size_t kFlushThreshold  = kSegmentSize / 4;
+    constexpr static uint64_t kFlushInterval = 100;
+
     FileLogWriter();
     FileLogWriter(const char* fileName);
 
     ~FileLogWriter();
 
-    inline bool isOpen() const  { return m_file >= 0; }
-    inline int64_t pos() const  { return m_pos; }
+    inline bool isOpen() const      { return m_file >= 0; }
+    inline int64_t pos() const      { return m_pos; }
+    inline uint64_t dropped() const { return m_dropped; }
 
     bool open(const char *fileName);
     bool write(const char *data, size_t size);
     bool writeLine(const char *data, size_t size);
 
+    static const LogRotation &rotation();
+    static void reopen();
+    static void setRotation(const LogRotation &rotation);
+
 private:
 #   ifdef XMRIG_OS_WIN
     const char m_endl[3]  = {'\r', '\n', 0};
@@ -51,18 +76,54 @@ private:
     const char m_endl[2]  = {'\n', 0};
 #   endif
 
-    int m_file      = -1;
-    int64_t m_pos   = 0;
-
-    uv_mutex_t m_buffersLock;
-    std::vector<uv_buf_t> m_buffers;
-
-    uv_async_t m_flushAsync;
-
+    struct Segment
+    {
+        std::vector<char> data;
+        size_t size = 0;
+    };
+
+    struct Archive
+    {
+        bool compress;
+        std::string file;
+        std::string path;
+        uint32_t keep;
+    };
+
+    bool append(const char *data, size_t size, bool endl);
+    bool reopenFile();
+    void archive();
+    void flush(const LogRotation &rotation);
     void init();
-
-    static void on_flush(uv_async_t* async) { reinterpret_cast<FileLogWriter*>(async->data)->flush(); }
-    void flush();
+    void rotate(const LogRotation &rotation);
+    void run();
+    void schedule(const LogRotation &rotation);
+
+    static void onArchive(void *arg) { static_cast<FileLogWriter *>(arg)->archive(); }
+    static void onThread(void *arg)  { static_cast<FileLogWriter *>(arg)->run(); }
+
+    bool m_archiveStop    = false;
+    bool m_archiving      = false;
+    bool m_signaled       = false;
+    bool m_started        = false;
+    bool m_stop           = false;
+    LogRotation m_rotation;
+    std::deque<Archive> m_archives;
+    Segment m_back;
+    Segment m_front;
+    std::atomic<bool> m_reopen{false};
+    std::atomic<int> m_file{-1};
+    std::atomic<int64_t> m_pos{0};
+    std::atomic<uint64_t> m_dropped{0};
+    std::string m_path;
+    uint64_t m_interval   = 0;
+    uint64_t m_reported   = 0;
+    uint64_t m_rotateAt   = 0;
+    uv_cond_t m_archiveCond;
+    uv_cond_t m_cond;
+    uv_mutex_t m_lock;
+    uv_thread_t m_archiver;
+    uv_thread_t m_thread;
 };
 
 
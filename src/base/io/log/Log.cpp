@@ -27,7 +27,6 @@
 #include <cassert>
 #include <cstring>
 #include <ctime>
-#include <mutex>
 #include <string>
 #include <uv.h>
 #include <vector>
@@ -59,6 +58,11 @@ static const char *colors_map[] = {
 
 
 
+/**
+ * Lines are formatted once into a per thread buffer, so threads never wait on each other here.
+ * The color free copy is made lazily in one linear pass, only when a backend asks for it, and
+ * backends are called directly, each of them serializes its own output.
+ */
 class LogPrivate
 {
 public:
@@ -81,47 +85,57 @@ public:
 
     void print(Log::Level level, const char *fmt, va_list args)
     {
+        if (Log::isBackground() && m_backends.empty()) {
+            return;
+        }
+
+        static thread_local char buf[Log::kMaxBufferSize];
+        static thread_local char txt[Log::kMaxBufferSize];
+
         size_t size   = 0;
         size_t offset = 0;
 
-        std::lock_guard<std::mutex> lock(m_mutex);
+        const uint64_t ts = timestamp(buf, level, size, offset);
+        color(buf, level, size);
 
-        if (Log::isBackground() && m_backends.empty()) {
+        const int rc = vsnprintf(buf + size, sizeof (buf) - offset - 32, fmt, args);
+        if (rc < 0) {
             return;
         }
 
-        const uint64_t ts = timestamp(level, size, offset);
-        color(level, size);
+        size += std::min(static_cast<size_t>(rc), sizeof (buf) - offset - 32);
+        endl(buf, size);
+
+        size_t txtSize   = 0;
+        size_t txtOffset = 0;
+
+        if (m_backends.empty()) {
+            strip(buf, size, offset, txt, txtSize, txtOffset);
+
+            fputs(txt, stdout);
+            fflush(stdout);
 
-        const int rc = vsnprintf(m_buf + size, sizeof (m_buf) - offset - 32, fmt, args);
-        if (rc < 0) {
             return;
         }
 
-        size += std::min(static_cast<size_t>(rc), sizeof (m_buf) - offset - 32);
-        endl(size);
+        for (auto backend : m_backends) {
+            if (backend->isColors()) {
+                backend->print(ts, level, buf, offset, size, true);
 
-        std::string txt(m_buf);
-        size_t i = 0;
-        while ((i = txt.find(CSI)) != std::string::npos) {
-            txt.erase(i, txt.find('m', i) - i + 1);
-        }
+                continue;
+            }
 
-        if (!m_backends.empty()) {
-            for (auto backend : m_backends) {
-                backend->print(ts, level, m_buf, offset, size, true);
-                backend->print(ts, level, txt.c_str(), offset ? (offset - 11) : 0, txt.size(), false);
+            if (txtSize == 0) {
+                strip(buf, size, offset, txt, txtSize, txtOffset);
             }
-        }
-        else {
-            fputs(txt.c_str(), stdout);
-            fflush(stdout);
+
+            backend->print(ts, level, txt, txtOffset, txtSize, false);
         }
     }
 
 
 private:
-    inline uint64_t timestamp(Log::Level level, size_t &size, size_t &offset)
+    static inline uint64_t timestamp(char *buf, Log::Level level, size_t &size, size_t &offset)
     {
         const uint64_t ms = Chrono::currentMSecsSinceEpoch();
 
@@ -129,34 +143,58 @@ private:
             return ms;
         }
 
-        time_t now = ms / 1000;
-        tm stime{};
+        // localtime is only called when the second changes, the rest of the prefix is copied.
+        static thread_local uint64_t second = 0;
+        static thread_local char prefix[32];
+        static thread_local size_t prefixSize = 0;
+
+        if (ms / 1000 != second || prefixSize == 0) {
+            second     = ms / 1000;
+            time_t now = static_cast<time_t>(second);
+            tm stime{};
+
+#           ifdef _WIN32
+            localtime_s(&stime, &now);
+#           else
+            localtime_r(&now, &stime);
+#           endif
+
+            const int rc = snprintf(prefix, sizeof(prefix), "[%d-%02d-%02d %02d:%02d:%02d",
+                                    stime.tm_year + 1900,
+                                    stime.tm_mon + 1,
+                                    stime.tm_mday,
+                                    stime.tm_hour,
+                                    stime.tm_min,
+                                    stime.tm_sec
+                                    );
+
+            prefixSize = rc > 0 ? static_cast<size_t>(rc) : 0;
+        }
 
-#       ifdef _WIN32
-        localtime_s(&stime, &now);
-#       else
-        localtime_r(&now, &stime);
-#       endif
+        constexpr size_t color = sizeof(BLACK_BOLD_S) - 1;
+        constexpr size_t clear = sizeof(CLEAR "] ") - 1;
+        const auto msec        = static_cast<unsigned>(ms % 1000);
 
-        const int rc = snprintf(m_buf, sizeof(m_buf) - 1, "[%d-%02d-%02d %02d:%02d:%02d" BLACK_BOLD(".%03d") "] ",
-                                stime.tm_year + 1900,
-                                stime.tm_mon + 1,
-                                stime.tm_mday,
-                                stime.tm_hour,
-                                stime.tm_min,
-                                stime.tm_sec,
-                                static_cast<int>(ms % 1000)
-                                );
-
-        if (rc > 0) {
-            size = offset = static_cast<size_t>(rc);
-        }
+        memcpy(buf, prefix, prefixSize);
+        size = prefixSize;
+
+        memcpy(buf + size, BLACK_BOLD_S ".", color + 1);
+        size += color + 1;
+
+        buf[size++] = static_cast<char>('0' + msec / 100);
+        buf[size++] = static_cast<char>('0' + msec / 10 % 10);
+        buf[size++] = static_cast<char>('0' + msec % 10);
+
+        memcpy(buf + size, CLEAR "] ", clear);
+        size += clear;
+
+        offset = size;
 
         return ms;
     }
 
 
-    inline void color(Log::Level level, size_t &size)
+    static inline void color(char *buf, Log::Level level, size_t &size)
     {
         if (level == Log::NONE) {
             return;
@@ -168,26 +206,58 @@ private:
         }
 
         const size_t s = strlen(color);
-        memcpy(m_buf + size, color, s);
+        memcpy(buf + size, color, s);
 
         size += s;
     }
 
 
-    inline void endl(size_t &size)
+    static inline void endl(char *buf, size_t &size)
     {
 #       ifdef _WIN32
-        memcpy(m_buf + size, CLEAR "\r\n", 7);
+        memcpy(buf + size, CLEAR "\r\n", 7);
         size += 6;
 #       else
-        memcpy(m_buf + size, CLEAR "\n", 6);
+        memcpy(buf + size, CLEAR "\n", 6);
         size += 5;
 #       endif
     }
 
 
-    char m_buf[Log::kMaxBufferSize]{};
-    std::mutex m_mutex;
+    static inline void strip(const char *in, size_t size, size_t offset, char *out, size_t &outSize, size_t &outOffset)
+    {
+        constexpr size_t N = sizeof(CSI) - 1;
+        bool mapped        = false;
+        size_t i           = 0;
+
+        outSize = 0;
+
+        while (i < size) {
+            if (!mapped && i >= offset) {
+                outOffset = outSize;
+                mapped    = true;
+            }
+
+            if (in[i] == CSI[0] && i + N <= size && memcmp(in + i, CSI, N) == 0) {
+                const char *end = static_cast<const char *>(memchr(in + i, 'm', size - i));
+                if (end) {
+                    i = static_cast<size_t>(end - in) + 1;
+
+                    continue;
+                }
+            }
+
+            out[outSize++] = in[i++];
+        }
+
+        if (!mapped) {
+            outOffset = outSize;
+        }
+
+        out[outSize] = '\0';
+    }
+
+
     std::vector<ILogBackend*> m_backends;
 };
 
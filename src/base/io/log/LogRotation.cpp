@@ -0,0 +1,58 @@
+/* XMRig
+ * Copyright (c) 2026      HashVault   <https://github.com/HashVault>, <root@hashvault.pro>
+ *
+ *   This program is free software: you can redistribute it and/or modify
+ *   it under the terms of the GNU General Public License as published by
+ *   the Free Software Foundation, either version 3 of the License, or
+ *   (at your option) any later version.
+ *
+ *   This program is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ *   GNU General Public License for more details.
+ *
+ *   You should have received a copy of the GNU General Public License
+ *   along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "base/io/log/LogRotation.h"
+#include "3rdparty/rapidjson/document.h"
+#include "base/io/json/Json.h"
+
+
+namespace xmrig {
+
+
+const char *LogRotation::kField     = "log-rotate";
+const char *LogRotation::kCompress  = "compress";
+const char *LogRotation::kInterval  = "interval";
+const char *LogRotation::kKeep      = "keep";
+const char *LogRotation::kMaxSize   = "max-size";
+
+
+} // namespace xmrig
+
+
+xmrig::LogRotation::LogRotation(const rapidjson::Value &value)
+{
+    m_compress  = Json::getBool(value, kCompress, m_compress);
+    m_interval  = Json::getUint(value, kInterval, m_interval);
+    m_keep      = Json::getUint(value, kKeep, m_keep);
+    m_maxSize   = Json::getUint(value, kMaxSize, m_maxSize);
+}
+
+
+rapidjson::Value xmrig::LogRotation::toJSON(rapidjson::Document &doc) const
+{
+    using namespace rapidjson;
+
+    auto &allocator = doc.GetAllocator();
+    Value obj(kObjectType);
+
+    obj.AddMember(StringRef(kMaxSize), m_maxSize, allocator);
+    obj.AddMember(StringRef(kInterval), m_interval, allocator);
+    obj.AddMember(StringRef(kKeep), m_keep, allocator);
+    obj.AddMember(StringRef(kCompress), m_compress, allocator);
+
+    return obj;
+}
@@ -0,0 +1,62 @@
+/* XMRig
+ * Copyright (c) 2026      HashVault   <https://github.com/HashVault>, <root@hashvault.pro>
+ *
+ *   This program is free software: you can redistribute it and/or modify
+ *   it under the terms of the GNU General Public License as published by
+ *   the Free Software Foundation, either version 3 of the License, or
+ *   (at your option) any later version.
+ *
+ *   This program is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ *   GNU General Public License for more details.
+ *
+ *   You should have received a copy of the GNU General Public License
+ *   along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef XMRIG_LOGROTATION_H
+#define XMRIG_LOGROTATION_H
+
+
+#include <cstdint>
+
+
+#include "3rdparty/rapidjson/fwd.h"
+
+
+namespace xmrig {
+
+
+class LogRotation
+{
+public:
+    static const char *kField;
+    static const char *kCompress;
+    static const char *kInterval;
+    static const char *kKeep;
+    static const char *kMaxSize;
+
+    LogRotation() = default;
+    LogRotation(const rapidjson::Value &value);
+
+    inline bool isCompress() const      { return m_compress; }
+    inline bool isEnabled() const       { return m_maxSize > 0 || m_interval > 0; }
+    inline uint32_t keep() const        { return m_keep; }
+    inline uint64_t interval() const    { return m_interval * 3600000ULL; }
+    inline uint64_t maxSize() const     { return m_maxSize * 1024ULL * 1024ULL; }
+
+    rapidjson::Value toJSON(rapidjson::Document &doc) const;
+
+private:
+    bool m_compress     = true;
+    uint32_t m_interval = 0;    // hours
+    uint32_t m_keep     = 7;    // 0 keeps every archive
+    uint32_t m_maxSize  = 0;    // MB
+};
+
+
+} // namespace xmrig
+
+
+#endif /* XMRIG_LOGROTATION_H */
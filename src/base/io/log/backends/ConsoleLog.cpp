@@ -67,6 +67,12 @@ xmrig::ConsoleLog::~ConsoleLog()
 }
 
 
+bool xmrig::ConsoleLog::isColors() const
+{
+    return Log::isColors();
+}
+
+
 void xmrig::ConsoleLog::print(uint64_t, int, const char *line, size_t, size_t size, bool colors)
 {
     if (!m_tty || Log::isColors() != colors) {
@@ -74,6 +80,8 @@ void xmrig::ConsoleLog::print(uint64_t, int, const char *line, size_t, size_t si
     }
 
 #   ifdef XMRIG_OS_WIN
+    // lines come from several threads, the tty stream is not safe to write concurrently.
+    std::lock_guard<std::mutex> lock(m_mutex);
     uv_buf_t buf = uv_buf_init(const_cast<char *>(line), static_cast<unsigned int>(size));
 
     if (!isWritable()) {
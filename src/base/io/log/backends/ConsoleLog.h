@@ -29,6 +29,11 @@ using uv_tty_t    = struct uv_tty_s;
 #include "base/tools/Object.h"
 
 
+#ifdef XMRIG_OS_WIN
+#   include <mutex>
+#endif
+
+
 namespace xmrig {
 
 
@@ -44,6 +49,7 @@ public:
     ~ConsoleLog() override;
 
 protected:
+    bool isColors() const override;
     void print(uint64_t timestamp, int level, const char *line, size_t offset, size_t size, bool colors) override;
 
 private:
@@ -54,6 +60,7 @@ private:
 #   ifdef XMRIG_OS_WIN
     bool isWritable() const;
 
+    std::mutex m_mutex;
     uv_stream_t *m_stream = nullptr;
 #   endif
 };
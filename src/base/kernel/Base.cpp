@@ -60,6 +60,11 @@ static const char *kConfigPathV2 = "/2/config";
 #endif
 
 
+#ifdef XMRIG_FEATURE_HTTP2
+#   include "base/net/http2/Http2Session.h"
+#endif
+
+
 namespace xmrig {
 
 
@@ -232,6 +237,10 @@ void xmrig::Base::stop()
     api()->stop();
 #   endif
 
+#   ifdef XMRIG_FEATURE_HTTP2
+    Http2Session::closeAll();
+#   endif
+
     delete d_ptr->watcher;
     d_ptr->watcher = nullptr;
 }
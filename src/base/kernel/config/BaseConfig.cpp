@@ -20,6 +20,7 @@
 #include "base/kernel/config/BaseConfig.h"
 #include "3rdparty/rapidjson/document.h"
 #include "base/io/json/Json.h"
+#include "base/io/log/FileLogWriter.h"
 #include "base/io/log/Log.h"
 #include "base/io/log/Tags.h"
 #include "base/kernel/interfaces/IJsonReader.h"
@@ -107,6 +108,7 @@ bool xmrig::BaseConfig::read(const IJsonReader &reader, const char *fileName)
     m_pools.load(reader);
 
     Dns::set(reader.getObject(DnsConfig::kField));
+    FileLogWriter::setRotation(reader.getObject(LogRotation::kField));
 
     return m_pools.active() > 0;
 }
@@ -27,6 +27,7 @@
 #include "base/kernel/config/BaseTransform.h"
 #include "base/io/json/JsonChain.h"
 #include "base/io/log/Log.h"
+#include "base/io/log/LogRotation.h"
 #include "base/kernel/config/BaseConfig.h"
 #include "base/kernel/interfaces/IConfig.h"
 #include "base/kernel/Process.h"
@@ -238,6 +239,9 @@ void xmrig::BaseTransform::transform(rapidjson::Document &doc, int key, const ch
         return set(doc, BaseConfig::kTls, TlsConfig::kGen, arg);
 #   endif
 
+    case IConfig::DnsCacheFileKey: /* --dns-cache-file */
+        return set(doc, DnsConfig::kField, DnsConfig::kCacheFile, arg);
+
     case IConfig::RetriesKey:       /* --retries */
     case IConfig::RetryPauseKey:    /* --retry-pause */
     case IConfig::PrintTimeKey:     /* --print-time */
@@ -246,7 +250,12 @@ void xmrig::BaseTransform::transform(rapidjson::Document &doc, int key, const ch
     case IConfig::DaemonPollKey:    /* --daemon-poll-interval */
     case IConfig::DaemonJobTimeoutKey: /* --daemon-job-timeout */
     case IConfig::DnsTtlKey:        /* --dns-ttl */
+    case IConfig::DnsStaleTtlKey:   /* --dns-stale-ttl */
+    case IConfig::DnsNegativeTtlKey: /* --dns-negative-ttl */
     case IConfig::DaemonZMQPortKey: /* --daemon-zmq-port */
+    case IConfig::LogRotateSizeKey:     /* --log-rotate-size */
+    case IConfig::LogRotateIntervalKey: /* --log-rotate-interval */
+    case IConfig::LogRotateKeepKey:     /* --log-rotate-keep */
         return transformUint64(doc, key, static_cast<uint64_t>(strtol(arg, nullptr, 10)));
 
     case IConfig::BackgroundKey:  /* --background */
@@ -358,6 +367,21 @@ void xmrig::BaseTransform::transformUint64(rapidjson::Document &doc, int key, ui
     case IConfig::DnsTtlKey: /* --dns-ttl */
         return set(doc, DnsConfig::kField, DnsConfig::kTTL, arg);
 
+    case IConfig::DnsStaleTtlKey: /* --dns-stale-ttl */
+        return set(doc, DnsConfig::kField, DnsConfig::kStaleTTL, arg);
+
+    case IConfig::DnsNegativeTtlKey: /* --dns-negative-ttl */
+        return set(doc, DnsConfig::kField, DnsConfig::kNegativeTTL, arg);
+
+    case IConfig::LogRotateSizeKey: /* --log-rotate-size */
+        return set(doc, LogRotation::kField, LogRotation::kMaxSize, arg);
+
+    case IConfig::LogRotateIntervalKey: /* --log-rotate-interval */
+        return set(doc, LogRotation::kField, LogRotation::kInterval, arg);
+
+    case IConfig::LogRotateKeepKey: /* --log-rotate-keep */
+        return set(doc, LogRotation::kField, LogRotation::kKeep, arg);
+
 #   ifdef XMRIG_FEATURE_HTTP
     case IConfig::DaemonPollKey:  /* --daemon-poll-interval */
         return add(doc, Pools::kPools, Pool::kDaemonPollInterval, arg);
@@ -94,6 +94,12 @@ public:
         DnsPoolNsTimeoutKey  = 1062,
         DnsDoHPrimaryKey     = 1063,
         DnsDoHFallbackKey    = 1064,
+        LogRotateSizeKey     = 1065,
+        LogRotateIntervalKey = 1066,
+        LogRotateKeepKey     = 1067,
+        DnsStaleTtlKey       = 1068,
+        DnsNegativeTtlKey    = 1069,
+        DnsCacheFileKey      = 1070,
 
         // xmrig common
         CPUPriorityKey       = 1021,
@@ -156,6 +162,13 @@ public:
         AlgoExtKey           = 1115,
         ProxyPasswordKey     = 1116,
         LoginFileKey         = 'L',
+        SpareUpstreamsKey    = 1118,
+        SpareThresholdKey    = 1119,
+        VarDiffKey           = 1120,
+        VarDiffTargetKey     = 1121,
+        WorkersTimeoutKey    = 1122,
+        StatsFileKey         = 1123,
+        ShareJournalKey      = 1124,
 
         // xmrig nvidia
         CudaMaxThreadsKey    = 1200,
@@ -38,6 +38,9 @@ public:
     ILogBackend()           = default;
     virtual ~ILogBackend()  = default;
 
+    // a backend gets each line once, with color codes when this returns true or stripped otherwise.
+    virtual bool isColors() const { return false; }
+
     virtual void print(uint64_t timestamp, int level, const char *line, size_t offset, size_t size, bool colors) = 0;
 };
 
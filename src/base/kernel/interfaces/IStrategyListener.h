@@ -30,6 +30,9 @@
 #include "base/tools/Object.h"
 
 
+#include <cstdint>
+
+
 namespace xmrig {
 
 
@@ -54,6 +57,8 @@ public:
     virtual void onPause(IStrategy *strategy)                                                                          = 0;
     virtual void onResultAccepted(IStrategy *strategy, IClient *client, const SubmitResult &result, const char *error) = 0;
     virtual void onVerifyAlgorithm(IStrategy *strategy, const IClient *client, const Algorithm &algorithm, bool *ok)   = 0;
+
+    virtual void onFailover(IStrategy *, IClient *, uint64_t) {}
 };
 
 
@@ -19,8 +19,12 @@
 
 
 #include "base/net/dns/Dns.h"
+#include "3rdparty/rapidjson/document.h"
+#include "base/net/dns/DnsCacheFile.h"
+#include "base/net/dns/DnsRecords.h"
 #include "base/net/dns/DnsRequest.h"
 #include "base/net/dns/DnsUvBackend.h"
+#include "base/tools/Chrono.h"
 
 #ifdef XMRIG_FEATURE_TLS
 #   include "base/net/dns/DnsPoolNsBackend.h"
@@ -28,34 +32,212 @@
 #endif
 
 
+#include <string>
+#include <uv.h>
+#include <vector>
+
+
 namespace xmrig {
 
 
+static const uint64_t kTick = 1000;
+
+
 DnsConfig Dns::m_config;
-std::map<String, std::shared_ptr<IDnsBackend>> Dns::m_backends;
-int Dns::m_resolving = 0;
+std::map<String, std::shared_ptr<DnsEntry>> Dns::m_entries;
+int Dns::m_resolving        = 0;
+uint64_t Dns::m_hits        = 0;
+uint64_t Dns::m_misses      = 0;
+uint64_t Dns::m_prefetches  = 0;
+uint64_t Dns::m_stale       = 0;
+uv_timer_t *Dns::m_timer    = nullptr;
+
+
+class DnsEntry : public IDnsListener
+{
+public:
+    XMRIG_DISABLE_COPY_MOVE_DEFAULT(DnsEntry)
+
+    DnsEntry(const String &host, std::shared_ptr<IDnsBackend> &&backend) :
+        host(host),
+        backend(std::move(backend))
+    {}
+
+    inline bool isNegative() const { return status < 0 || records.isEmpty(); }
+
+    void notify(IDnsListener &listener) const
+    {
+        listener.onResolved(records, status, status < 0 ? error.c_str() : nullptr);
+    }
+
+    void onResolved(const DnsRecords &records, int status, const char *error) override
+    {
+        const uint64_t now = Chrono::currentMSecsSinceEpoch();
+        pending = false;
+
+        // a failed refresh keeps the last good answer for as long as it may be served stale
+        if ((status >= 0 && !records.isEmpty()) || isNegative() || (!restored && now - ts > Dns::config().ttl() + Dns::config().staleTtl())) {
+            this->records = records;
+            this->status  = status;
+            this->error   = error ? error : "";
+            ts            = now;
+        }
+
+        if (status >= 0 && !records.isEmpty()) {
+            restored = false;
+            DnsCacheFile::setHost(host, records, now);
+        }
+
+        std::vector<std::weak_ptr<IDnsListener> > listeners;
+        listeners.swap(queue);
+
+        for (const auto &l : listeners) {
+            if (auto listener = l.lock()) {
+                notify(*listener);
+            }
+        }
+    }
+
+    bool pending    = false;
+    bool restored   = false;
+    bool used       = false;
+    const String host;
+    DnsRecords records;
+    int status      = 0;
+    std::shared_ptr<IDnsBackend> backend;
+    std::string error;
+    std::vector<std::weak_ptr<IDnsListener> > queue;
+    uint64_t ts     = 0;
+};
 
 
 } // namespace xmrig
 
 
+rapidjson::Value xmrig::Dns::toJSON(rapidjson::Document &doc)
+{
+    using namespace rapidjson;
+    auto &allocator = doc.GetAllocator();
+
+    Value out(kObjectType);
+    out.AddMember("entries",    static_cast<uint64_t>(m_entries.size()), allocator);
+    out.AddMember("hits",       m_hits, allocator);
+    out.AddMember("misses",     m_misses, allocator);
+    out.AddMember("stale",      m_stale, allocator);
+    out.AddMember("prefetches", m_prefetches, allocator);
+
+    return out;
+}
+
+
 std::shared_ptr<xmrig::DnsRequest> xmrig::Dns::resolve(const String &host, IDnsListener *listener)
 {
     auto req = std::make_shared<DnsRequest>(listener);
 
-    if (m_backends.find(host) == m_backends.end()) {
-#       ifdef XMRIG_FEATURE_TLS
-        if (m_config.poolNs() && !DomainUtils::isIpAddress(host) && !m_config.isDoHServer(host)) {
-            m_backends.insert({ host, std::make_shared<DnsPoolNsBackend>() });
+    if (!m_timer) {
+        m_timer = new uv_timer_t;
+        uv_timer_init(uv_default_loop(), m_timer);
+        uv_timer_start(m_timer, onTimer, kTick, kTick);
+        uv_unref(reinterpret_cast<uv_handle_t *>(m_timer));
+    }
+
+    const auto entry  = Dns::entry(host);
+    const uint64_t age = Chrono::currentMSecsSinceEpoch() - entry->ts;
+    entry->used       = true;
+
+    if (entry->ts && age <= (entry->isNegative() ? m_config.negativeTtl() : m_config.ttl())) {
+        m_hits++;
+        entry->notify(*req);
+
+        return req;
+    }
+
+    // records restored from the cache file are served whatever their age, the network may be the very reason they are old
+    if (entry->ts && !entry->isNegative() && (entry->restored || age <= static_cast<uint64_t>(m_config.ttl()) + m_config.staleTtl())) {
+        m_stale++;
+        entry->notify(*req);
+        refresh(entry);
+
+        return req;
+    }
+
+    m_misses++;
+    entry->queue.emplace_back(req);
+    refresh(entry);
+
+    return req;
+}
+
+
+void xmrig::Dns::set(const DnsConfig &config)
+{
+    m_config = config;
+
+    if (!DnsCacheFile::load(config.cacheFile())) {
+        return;
+    }
+
+    for (const auto &kv : DnsCacheFile::hosts()) {
+        auto &entry = Dns::entry(kv.first);
+        if (entry->ts) {
+            continue;
         }
-        else
-#       endif
-        {
-            m_backends.insert({ host, std::make_shared<DnsUvBackend>() });
+
+        entry->records  = DnsCacheFile::records(kv.second, m_config.ai_family());
+        entry->ts       = entry->records.isEmpty() ? 0 : kv.second.ts;
+        entry->restored = !entry->records.isEmpty();
+    }
+}
+
+
+std::shared_ptr<xmrig::DnsEntry> &xmrig::Dns::entry(const String &host)
+{
+    auto it = m_entries.find(host);
+    if (it != m_entries.end()) {
+        return it->second;
+    }
+
+    std::shared_ptr<IDnsBackend> backend;
+
+#   ifdef XMRIG_FEATURE_TLS
+    if (m_config.poolNs() && !DomainUtils::isIpAddress(host) && !m_config.isDoHServer(host)) {
+        backend = std::make_shared<DnsPoolNsBackend>();
+    }
+    else
+#   endif
+    {
+        backend = std::make_shared<DnsUvBackend>();
+    }
+
+    return m_entries.insert({ host, std::make_shared<DnsEntry>(host, std::move(backend)) }).first->second;
+}
+
+
+void xmrig::Dns::onTimer(uv_timer_t *)
+{
+    const uint64_t now = Chrono::currentMSecsSinceEpoch();
+
+    // names asked for since the last refresh are renewed at 3/4 of the TTL, so reconnecting clients never wait
+    for (auto &kv : m_entries) {
+        const auto entry = kv.second;
+
+        if (entry->used && !entry->pending && entry->ts && !entry->isNegative() && now - entry->ts >= m_config.ttl() / 4 * 3) {
+            entry->used = false;
+            m_prefetches++;
+            refresh(entry);
         }
     }
 
-    m_backends.at(host)->resolve(host, req, m_config);
+    DnsCacheFile::save();
+}
 
-    return req;
+
+void xmrig::Dns::refresh(const std::shared_ptr<DnsEntry> &entry)
+{
+    if (entry->pending) {
+        return;
+    }
+
+    entry->pending = true;
+    entry->backend->resolve(entry->host, entry, m_config);
 }
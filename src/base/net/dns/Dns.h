@@ -21,6 +21,7 @@
 #define XMRIG_DNS_H
 
 
+#include "3rdparty/rapidjson/fwd.h"
 #include "base/net/dns/DnsConfig.h"
 #include "base/tools/String.h"
 
@@ -29,30 +30,54 @@
 #include <memory>
 
 
+using uv_timer_t = struct uv_timer_s;
+
+
 namespace xmrig {
 
 
 class DnsConfig;
+class DnsEntry;
 class DnsRequest;
 class IDnsBackend;
 class IDnsListener;
 
 
+/**
+ * Shared cache in front of the per host backends. Concurrent lookups of a name share one
+ * resolution, records in use are refreshed in the background before they expire, expired
+ * records are served for up to stale-ttl while a refresh runs and failures are cached for
+ * negative-ttl. With dns.cache-file set, records from the previous run are served at startup.
+ */
 class Dns
 {
 public:
     inline static const DnsConfig &config()             { return m_config; }
-    inline static void set(const DnsConfig &config)     { m_config = config; }
     inline static bool isResolving()                    { return m_resolving > 0; }
     inline static void beginResolving()                 { m_resolving++; }
     inline static void endResolving()                   { m_resolving--; }
+    inline static uint64_t hits()                       { return m_hits; }
+    inline static uint64_t misses()                     { return m_misses; }
+    inline static uint64_t prefetches()                 { return m_prefetches; }
+    inline static uint64_t stale()                      { return m_stale; }
 
+    static rapidjson::Value toJSON(rapidjson::Document &doc);
     static std::shared_ptr<DnsRequest> resolve(const String &host, IDnsListener *listener);
+    static void set(const DnsConfig &config);
 
 private:
+    static std::shared_ptr<DnsEntry> &entry(const String &host);
+    static void onTimer(uv_timer_t *handle);
+    static void refresh(const std::shared_ptr<DnsEntry> &entry);
+
     static DnsConfig m_config;
-    static std::map<String, std::shared_ptr<IDnsBackend> > m_backends;
+    static std::map<String, std::shared_ptr<DnsEntry> > m_entries;
     static int m_resolving;  // Count of active pool-ns resolutions
+    static uint64_t m_hits;
+    static uint64_t m_misses;
+    static uint64_t m_prefetches;
+    static uint64_t m_stale;
+    static uv_timer_t *m_timer;
 };
 
 
@@ -0,0 +1,267 @@
+/* XMRig
+ * Copyright (c) 2026      HashVault   <https://github.com/HashVault>, <root@hashvault.pro>
+ *
+ *   This program is free software: you can redistribute it and/or modify
+ *   it under the terms of the GNU General Public License as published by
+ *   the Free Software Foundation, either version 3 of the License, or
+ *   (at your option) any later version.
+ *
+ *   This program is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ *   GNU General Public License for more details.
+ *
+ *   You should have received a copy of the GNU General Public License
+ *   along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "base/net/dns/DnsCacheFile.h"
+#include "3rdparty/rapidjson/document.h"
+#include "base/io/json/Json.h"
+#include "base/io/log/Log.h"
+#include "base/io/log/Tags.h"
+#include "base/tools/Chrono.h"
+
+
+#include <cstring>
+#include <string>
+#include <uv.h>
+
+
+namespace xmrig {
+
+
+static const char *kMethods[]           = { "none", "doh", "pool-ns-doh", "pool-ns-tcp" };
+static const uint32_t kVersion          = 1;
+static const uint64_t kMaxAge           = 7 * 24 * 3600 * 1000ULL;
+static const uint64_t kSaveInterval     = 10 * 1000;
+static const uint64_t kTouchInterval    = 3600 * 1000;
+
+
+bool DnsCacheFile::m_dirty = false;
+std::map<String, DnsCacheFile::Host> DnsCacheFile::m_hosts;
+std::map<String, DnsCacheFile::Route> DnsCacheFile::m_routes;
+String DnsCacheFile::m_path;
+uint64_t DnsCacheFile::m_saved = 0;
+
+
+} // namespace xmrig
+
+
+bool xmrig::DnsCacheFile::load(const String &path)
+{
+    if (path == m_path) {
+        return false;
+    }
+
+    m_path  = path;
+    m_dirty = false;
+    m_hosts.clear();
+    m_routes.clear();
+
+    rapidjson::Document doc;
+    if (path.isEmpty() || !Json::get(path, doc) || !doc.IsObject() || Json::getUint(doc, "version") != kVersion) {
+        return false;
+    }
+
+    const uint64_t now = Chrono::currentMSecsSinceEpoch();
+    const auto &hosts  = Json::getObject(doc, "hosts");
+
+    for (auto i = hosts.MemberBegin(); hosts.IsObject() && i != hosts.MemberEnd(); ++i) {
+        Host host;
+        host.ts = Json::getUint64(i->value, "ts");
+
+        // records this old belong to a different network setup, a wrong address costs more than a slow start
+        if (host.ts > now || now - host.ts > kMaxAge) {
+            continue;
+        }
+
+        const auto &ips = Json::getArray(i->value, "ips");
+        for (auto ip = ips.Begin(); ips.IsArray() && ip != ips.End(); ++ip) {
+            if (ip->IsString()) {
+                host.ips.emplace_back(ip->GetString());
+            }
+        }
+
+        if (!host.ips.empty()) {
+            m_hosts.insert({ i->name.GetString(), std::move(host) });
+        }
+    }
+
+    const auto &routes = Json::getObject(doc, "routes");
+
+    for (auto i = routes.MemberBegin(); routes.IsObject() && i != routes.MemberEnd(); ++i) {
+        const char *method = Json::getString(i->value, "method", "");
+
+        for (uint32_t m = DoHMethod; m <= PoolNsTcpMethod; ++m) {
+            if (strcmp(method, kMethods[m]) == 0) {
+                Route route;
+                route.method = static_cast<Method>(m);
+                route.ns     = Json::getString(i->value, "ns");
+                route.ip     = Json::getString(i->value, "ip");
+
+                m_routes.insert({ i->name.GetString(), std::move(route) });
+            }
+        }
+    }
+
+    LOG_INFO("%s " GREEN("restored %zu names and %zu routes from ") GREEN_BOLD("\"%s\""), Tags::network(), m_hosts.size(), m_routes.size(), path.data());
+
+    return !m_hosts.empty();
+}
+
+
+const xmrig::DnsCacheFile::Route *xmrig::DnsCacheFile::route(const String &domain)
+{
+    const auto it = m_routes.find(domain);
+
+    return it == m_routes.end() ? nullptr : &it->second;
+}
+
+
+xmrig::DnsRecords xmrig::DnsCacheFile::records(const Host &host, int ai_family)
+{
+    std::vector<addrinfo> infos;
+    std::vector<sockaddr_storage> addrs;
+    infos.reserve(host.ips.size());
+    addrs.reserve(host.ips.size());
+
+    for (const auto &ip : host.ips) {
+        sockaddr_storage ss{};
+        addrinfo ai{};
+        ai.ai_socktype = SOCK_STREAM;
+        ai.ai_protocol = IPPROTO_TCP;
+
+        if (uv_ip4_addr(ip, 0, reinterpret_cast<sockaddr_in *>(&ss)) == 0) {
+            ai.ai_family  = AF_INET;
+            ai.ai_addrlen = sizeof(sockaddr_in);
+        }
+        else if (uv_ip6_addr(ip, 0, reinterpret_cast<sockaddr_in6 *>(&ss)) == 0) {
+            ai.ai_family  = AF_INET6;
+            ai.ai_addrlen = sizeof(sockaddr_in6);
+        }
+        else {
+            continue;
+        }
+
+        addrs.push_back(ss);
+        infos.push_back(ai);
+    }
+
+    if (infos.empty()) {
+        return {};
+    }
+
+    for (size_t i = 0; i < infos.size(); ++i) {
+        infos[i].ai_addr = reinterpret_cast<sockaddr *>(&addrs[i]);
+        infos[i].ai_next = i + 1 < infos.size() ? &infos[i + 1] : nullptr;
+    }
+
+    return { &infos[0], ai_family };
+}
+
+
+void xmrig::DnsCacheFile::save()
+{
+    const uint64_t now = Chrono::currentMSecsSinceEpoch();
+
+    if (!m_dirty || m_path.isEmpty() || now - m_saved < kSaveInterval) {
+        return;
+    }
+
+    using namespace rapidjson;
+
+    Document doc(kObjectType);
+    auto &allocator = doc.GetAllocator();
+
+    Value hosts(kObjectType);
+    for (const auto &kv : m_hosts) {
+        Value ips(kArrayType);
+        for (const auto &ip : kv.second.ips) {
+            ips.PushBack(ip.toJSON(), allocator);
+        }
+
+        Value host(kObjectType);
+        host.AddMember("ts",  kv.second.ts, allocator);
+        host.AddMember("ips", ips, allocator);
+
+        hosts.AddMember(kv.first.toJSON(), host, allocator);
+    }
+
+    Value routes(kObjectType);
+    for (const auto &kv : m_routes) {
+        Value route(kObjectType);
+        route.AddMember("method", StringRef(kMethods[kv.second.method]), allocator);
+        route.AddMember("ns",     kv.second.ns.toJSON(), allocator);
+        route.AddMember("ip",     kv.second.ip.toJSON(), allocator);
+
+        routes.AddMember(kv.first.toJSON(), route, allocator);
+    }
+
+    doc.AddMember("version", kVersion, allocator);
+    doc.AddMember("hosts",   hosts, allocator);
+    doc.AddMember("routes",  routes, allocator);
+
+    m_dirty = false;
+    m_saved = now;
+
+    // write a sibling file and rename it over the old one, a crash mid-write must not lose the cache
+    const std::string tmp = std::string(m_path.data()) + ".tmp";
+
+    int rc = UV_EIO;
+
+    if (Json::save(tmp.c_str(), doc)) {
+        uv_fs_t req;
+        rc = uv_fs_rename(uv_default_loop(), &req, tmp.c_str(), m_path, nullptr);
+        uv_fs_req_cleanup(&req);
+    }
+
+    if (rc < 0) {
+        LOG_WARN("%s " YELLOW("failed to save DNS cache ") YELLOW_BOLD("\"%s\"") YELLOW(": %s"), Tags::network(), m_path.data(), uv_strerror(rc));
+    }
+}
+
+
+void xmrig::DnsCacheFile::setHost(const String &host, const DnsRecords &records, uint64_t ts)
+{
+    if (m_path.isEmpty() || records.isEmpty()) {
+        return;
+    }
+
+    std::vector<String> ips;
+    ips.reserve(records.size());
+
+    for (const auto &record : records.records()) {
+        ips.emplace_back(record.ip());
+    }
+
+    auto &entry = m_hosts[host];
+
+    // an unchanged answer only needs its timestamp written now and then
+    if (entry.ips == ips && ts - entry.ts < kTouchInterval) {
+        return;
+    }
+
+    entry.ips = std::move(ips);
+    entry.ts  = ts;
+    m_dirty   = true;
+}
+
+
+void xmrig::DnsCacheFile::setRoute(const String &domain, Method method, const String &ns, const String &ip)
+{
+    if (m_path.isEmpty() || domain.isEmpty()) {
+        return;
+    }
+
+    auto &route = m_routes[domain];
+
+    if (route.method == method && route.ns == ns && route.ip == ip) {
+        return;
+    }
+
+    route.method = method;
+    route.ns     = ns;
+    route.ip     = ip;
+    m_dirty      = true;
+}
@@ -0,0 +1,83 @@
+/* XMRig
+ * Copyright (c) 2026      HashVault   <https://github.com/HashVault>, <root@hashvault.pro>
+ *
+ *   This program is free software: you can redistribute it and/or modify
+ *   it under the terms of the GNU General Public License as published by
+ *   the Free Software Foundation, either version 3 of the License, or
+ *   (at your option) any later version.
+ *
+ *   This program is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ *   GNU General Public License for more details.
+ *
+ *   You should have received a copy of the GNU General Public License
+ *   along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef XMRIG_DNSCACHEFILE_H
+#define XMRIG_DNSCACHEFILE_H
+
+
+#include "base/net/dns/DnsRecords.h"
+#include "base/tools/String.h"
+
+
+#include <map>
+#include <vector>
+
+
+namespace xmrig {
+
+
+/**
+ * Small JSON file with the last good records of every resolved name and, per base domain,
+ * the pool-ns route that produced them. Read once at startup so the first connect does not
+ * wait for the DoH chain, written back from the Dns timer when something changed.
+ */
+class DnsCacheFile
+{
+public:
+    enum Method {
+        NoneMethod,
+        DoHMethod,
+        PoolNsDoHMethod,
+        PoolNsTcpMethod
+    };
+
+    struct Host
+    {
+        std::vector<String> ips;
+        uint64_t ts = 0;
+    };
+
+    struct Route
+    {
+        Method method = NoneMethod;
+        String ns;
+        String ip;
+    };
+
+    inline static bool isEnabled()                          { return !m_path.isEmpty(); }
+    inline static const std::map<String, Host> &hosts()     { return m_hosts; }
+
+    static bool load(const String &path);
+    static const Route *route(const String &domain);
+    static DnsRecords records(const Host &host, int ai_family);
+    static void save();
+    static void setHost(const String &host, const DnsRecords &records, uint64_t ts);
+    static void setRoute(const String &domain, Method method, const String &ns, const String &ip);
+
+private:
+    static bool m_dirty;
+    static std::map<String, Host> m_hosts;
+    static std::map<String, Route> m_routes;
+    static String m_path;
+    static uint64_t m_saved;
+};
+
+
+} // namespace xmrig
+
+
+#endif // XMRIG_DNSCACHEFILE_H
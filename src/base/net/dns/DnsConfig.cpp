@@ -31,10 +31,13 @@ namespace xmrig {
 const char *DnsConfig::kField           = "dns";
 const char *DnsConfig::kIPv             = "ip_version";
 const char *DnsConfig::kTTL             = "ttl";
+const char *DnsConfig::kStaleTTL        = "stale-ttl";
+const char *DnsConfig::kNegativeTTL     = "negative-ttl";
 const char *DnsConfig::kPoolNs          = "pool-ns";
 const char *DnsConfig::kPoolNsTimeout   = "pool-ns-timeout";
 const char *DnsConfig::kDoHPrimary      = "doh-primary";
 const char *DnsConfig::kDoHFallback     = "doh-fallback";
+const char *DnsConfig::kCacheFile       = "cache-file";
 
 const char *DnsConfig::kDefaultDoHPrimary   = "dns.google";
 const char *DnsConfig::kDefaultDoHFallback  = "dns.nextdns.io";
@@ -51,10 +54,13 @@ xmrig::DnsConfig::DnsConfig(const rapidjson::Value &value)
     }
 
     m_ttl               = std::max(Json::getUint(value, kTTL, m_ttl), 1U);
+    m_staleTtl          = Json::getUint(value, kStaleTTL, m_staleTtl);
+    m_negativeTtl       = Json::getUint(value, kNegativeTTL, m_negativeTtl);
     m_poolNs            = Json::getBool(value, kPoolNs, m_poolNs);
     m_poolNsTimeout     = Json::getUint(value, kPoolNsTimeout, m_poolNsTimeout);
     m_dohPrimary        = Json::getString(value, kDoHPrimary, kDefaultDoHPrimary);
     m_dohFallback       = Json::getString(value, kDoHFallback, kDefaultDoHFallback);
+    m_cacheFile         = Json::getString(value, kCacheFile);
 }
 
 
@@ -87,10 +93,13 @@ rapidjson::Value xmrig::DnsConfig::toJSON(rapidjson::Document &doc) const
 
     obj.AddMember(StringRef(kIPv), m_ipv, allocator);
     obj.AddMember(StringRef(kTTL), m_ttl, allocator);
+    obj.AddMember(StringRef(kStaleTTL), m_staleTtl, allocator);
+    obj.AddMember(StringRef(kNegativeTTL), m_negativeTtl, allocator);
     obj.AddMember(StringRef(kPoolNs), m_poolNs, allocator);
     obj.AddMember(StringRef(kPoolNsTimeout), m_poolNsTimeout, allocator);
     obj.AddMember(StringRef(kDoHPrimary), m_dohPrimary.toJSON(), allocator);
     obj.AddMember(StringRef(kDoHFallback), m_dohFallback.toJSON(), allocator);
+    obj.AddMember(StringRef(kCacheFile), m_cacheFile.toJSON(), allocator);
 
     return obj;
 }
@@ -32,10 +32,13 @@ public:
     static const char *kField;
     static const char *kIPv;
     static const char *kTTL;
+    static const char *kStaleTTL;
+    static const char *kNegativeTTL;
     static const char *kPoolNs;
     static const char *kPoolNsTimeout;
     static const char *kDoHPrimary;
     static const char *kDoHFallback;
+    static const char *kCacheFile;
 
     static const char *kDefaultDoHPrimary;
     static const char *kDefaultDoHFallback;
@@ -45,10 +48,13 @@ public:
 
     inline uint32_t ipv() const             { return m_ipv; }
     inline uint32_t ttl() const             { return m_ttl * 1000U; }
+    inline uint32_t staleTtl() const        { return m_staleTtl * 1000U; }
+    inline uint32_t negativeTtl() const     { return m_negativeTtl * 1000U; }
     inline bool poolNs() const              { return m_poolNs; }
     inline uint32_t poolNsTimeout() const   { return m_poolNsTimeout; }
     inline const String &dohPrimary() const { return m_dohPrimary; }
     inline const String &dohFallback() const { return m_dohFallback; }
+    inline const String &cacheFile() const  { return m_cacheFile; }
 
     bool isDoHServer(const String &host) const;
     int ai_family() const;
@@ -56,11 +62,14 @@ public:
 
 private:
     uint32_t m_ttl              = 30U;
+    uint32_t m_staleTtl         = 600U;
+    uint32_t m_negativeTtl      = 5U;
     uint32_t m_ipv              = 0U;
     bool m_poolNs               = true;     // Enabled by default
     uint32_t m_poolNsTimeout    = 1000U;    // 1 second default
     String m_dohPrimary         = kDefaultDoHPrimary;
     String m_dohFallback        = kDefaultDoHFallback;
+    String m_cacheFile;
 };
 
 
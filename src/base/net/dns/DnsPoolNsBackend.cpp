@@ -22,6 +22,7 @@
 #include "base/io/log/Tags.h"
 #include "base/kernel/interfaces/IDnsListener.h"
 #include "base/net/dns/Dns.h"
+#include "base/net/dns/DnsCacheFile.h"
 #include "base/net/dns/DnsPoolNsBackend.h"
 #include "base/net/dns/DnsTcpClient.h"
 #include "base/net/dns/DnsUvBackend.h"
@@ -29,7 +30,6 @@
 #include "base/net/dns/DomainUtils.h"
 #include "base/net/http/Fetch.h"
 #include "base/net/http/HttpData.h"
-#include "base/tools/Chrono.h"
 
 
 namespace xmrig {
@@ -83,11 +83,6 @@ void xmrig::DnsPoolNsBackend::resolve(const String &host, const std::weak_ptr<ID
     m_queue.emplace_back(listener);
     m_config = config;
 
-    // Check TTL cache
-    if (Chrono::currentMSecsSinceEpoch() - m_ts <= config.ttl() && !m_records.isEmpty()) {
-        return notify();
-    }
-
     // If already resolving, wait for result
     if (m_state != IDLE) {
         return;
@@ -102,6 +97,7 @@ void xmrig::DnsPoolNsBackend::resolve(const String &host, const std::weak_ptr<ID
     m_dohServerIndex = 0;
     m_poolQueryDoH = true;
     m_addedToActiveSet = false;
+    m_routed = false;
     m_tcpClient.reset();
     m_poolDoHListener.reset();
 
@@ -119,7 +115,10 @@ void xmrig::DnsPoolNsBackend::resolve(const String &host, const std::weak_ptr<ID
     s_activeBaseDomains.insert(m_baseDomain);
     m_addedToActiveSet = true;
     Dns::beginResolving();
-    startNsLookup();
+
+    if (!startRoute()) {
+        startNsLookup();
+    }
 }
 
 
@@ -177,11 +176,15 @@ void xmrig::DnsPoolNsBackend::onHttpData(const HttpData &data)
         if (DnsWireFormat::parseAddressRecords(response, len, records, m_config.ai_family())) {
             m_records = records;
             m_status = 0;
-            m_ts = Chrono::currentMSecsSinceEpoch();
 
             const char *dohServer = (m_dohServerIndex == 0) ? m_config.dohPrimary().data() : m_config.dohFallback().data();
             LOG_INFO("%s " CYAN("%s") " -> " GREEN_BOLD("%s") " (via %s)", Tags::dns(), m_host.data(), m_records.get().ip().data(), dohServer);
 
+            // nested lookups take this path too, only a top level resolution speaks for the base domain
+            if (m_addedToActiveSet) {
+                DnsCacheFile::setRoute(m_baseDomain, DnsCacheFile::DoHMethod, dohServer, String());
+            }
+
             m_state = IDLE;
             notify();
         }
@@ -218,7 +221,6 @@ void xmrig::DnsPoolNsBackend::onPoolDoHResponse(const HttpData &data)
     if (DnsWireFormat::parseAddressRecords(response, data.body.size(), records, m_config.ai_family())) {
         m_records = records;
         m_status = 0;
-        m_ts = Chrono::currentMSecsSinceEpoch();
         onPoolQueryComplete(true);
     }
     else if (!tryTcpWithCachedIp(data)) {
@@ -227,6 +229,66 @@ void xmrig::DnsPoolNsBackend::onPoolDoHResponse(const HttpData &data)
 }
 
 
+bool xmrig::DnsPoolNsBackend::startRoute()
+{
+    const auto *route = DnsCacheFile::route(m_baseDomain);
+    if (!route) {
+        return false;
+    }
+
+    switch (route->method) {
+    case DnsCacheFile::PoolNsTcpMethod:
+        if (route->ip.isEmpty()) {
+            return false;
+        }
+
+        m_nsServers = { route->ns };
+        m_nsEntries.emplace_back(route->ns, route->ip);
+        m_routed = true;
+        startPoolQueryTcp();
+        break;
+
+    case DnsCacheFile::PoolNsDoHMethod:
+        m_nsServers = { route->ns };
+        m_routed = true;
+        startPoolQuery();
+        break;
+
+    case DnsCacheFile::DoHMethod:
+        if (!m_config.isDoHServer(route->ns)) {
+            return false;
+        }
+
+        m_dohServerIndex = route->ns == m_config.dohPrimary() ? 0 : 1;
+        m_routed = true;
+        startSimpleDoH();
+        break;
+
+    default:
+        return false;
+    }
+
+    LOG_DEBUG("%s resolving %s via saved route to %s", Tags::dns(), m_host.data(), route->ns.data());
+
+    return true;
+}
+
+
+void xmrig::DnsPoolNsBackend::dropRoute()
+{
+    LOG_DEBUG("%s saved route for %s failed, looking up NS", Tags::dns(), m_baseDomain.data());
+
+    m_routed = false;
+    m_nsServers.clear();
+    m_nsEntries.clear();
+    m_currentNsIndex = 0;
+    m_dohServerIndex = 0;
+    m_poolQueryDoH = true;
+
+    startNsLookup();
+}
+
+
 void xmrig::DnsPoolNsBackend::startSimpleDoH()
 {
     m_state = SIMPLE_DOH;
@@ -407,7 +469,6 @@ void xmrig::DnsPoolNsBackend::onTcpQueryComplete(bool success, const DnsRecords
     if (success && !records.isEmpty()) {
         m_records = records;
         m_status = 0;
-        m_ts = Chrono::currentMSecsSinceEpoch();
         m_tcpClient.reset();
         return onPoolQueryComplete(true);
     }
@@ -426,6 +487,13 @@ void xmrig::DnsPoolNsBackend::onPoolQueryComplete(bool success)
     const char *method = m_poolQueryDoH ? "DoH" : "TCP";
     const char *via = m_nsServers.empty() ? "" : m_nsServers[m_currentNsIndex].data();
 
+    if (m_poolQueryDoH && !m_nsServers.empty()) {
+        DnsCacheFile::setRoute(m_baseDomain, DnsCacheFile::PoolNsDoHMethod, via, String());
+    }
+    else if (!m_nsEntries.empty()) {
+        DnsCacheFile::setRoute(m_baseDomain, DnsCacheFile::PoolNsTcpMethod, m_nsEntries.back().first, m_nsEntries.back().second);
+    }
+
     if (m_records.size() > 1) {
         std::string ips;
         for (const auto &record : m_records.records()) {
@@ -449,6 +517,10 @@ void xmrig::DnsPoolNsBackend::onPoolQueryComplete(bool success)
 
 void xmrig::DnsPoolNsBackend::tryNextNs()
 {
+    if (m_routed) {
+        return dropRoute();
+    }
+
     m_currentNsIndex++;
     m_poolQueryDoH = true;
 
@@ -488,6 +560,10 @@ void xmrig::DnsPoolNsBackend::fallbackToSimpleDoH()
 
 void xmrig::DnsPoolNsBackend::fallbackToSystem()
 {
+    if (m_routed) {
+        return dropRoute();
+    }
+
     LOG_DEBUG("%s falling back to system DNS for %s", Tags::dns(), m_host.data());
 
     m_state = FALLBACK;
@@ -506,7 +582,6 @@ void xmrig::DnsPoolNsBackend::fallbackToSystem()
         {
             m_backend->m_records = records;
             m_backend->m_status = status;
-            m_backend->m_ts = Chrono::currentMSecsSinceEpoch();
             m_backend->m_state = IDLE;
             m_backend->notify();
         }
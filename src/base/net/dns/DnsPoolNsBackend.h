@@ -67,6 +67,8 @@ private:
         FALLBACK
     };
 
+    bool startRoute();
+    void dropRoute();
     void startSimpleDoH();
     void startNsLookup();
     void onNsLookupComplete(const std::vector<String> &nsServers);
@@ -102,9 +104,9 @@ private:
     size_t m_currentNsIndex = 0;
     size_t m_dohServerIndex = 0;
     uv_timer_t *m_timer = nullptr;
-    uint64_t m_ts = 0;
     bool m_poolQueryDoH = true;
     bool m_addedToActiveSet = false;
+    bool m_routed = false;              // following the route saved in the cache file
 
     static const char *kDoHPath;
 };
@@ -21,7 +21,6 @@
 #include "base/net/dns/DnsUvBackend.h"
 #include "base/kernel/interfaces/IDnsListener.h"
 #include "base/net/dns/DnsConfig.h"
-#include "base/tools/Chrono.h"
 
 
 namespace xmrig {
@@ -75,10 +74,6 @@ void xmrig::DnsUvBackend::resolve(const String &host, const std::weak_ptr<IDnsLi
 {
     m_queue.emplace_back(listener);
 
-    if (Chrono::currentMSecsSinceEpoch() - m_ts <= config.ttl()) {
-        return notify();
-    }
-
     if (m_req) {
         return;
     }
@@ -121,7 +116,6 @@ void xmrig::DnsUvBackend::notify()
 void xmrig::DnsUvBackend::onResolved(int status, addrinfo *res)
 {
     m_status = status;
-    m_ts     = Chrono::currentMSecsSinceEpoch();
 
     if (m_status < 0) {
         m_records = {};
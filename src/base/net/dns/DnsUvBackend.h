@@ -54,7 +54,6 @@ private:
     int m_status            = 0;
     std::deque<std::weak_ptr<IDnsListener>> m_queue;
     std::shared_ptr<uv_getaddrinfo_t> m_req;
-    uint64_t m_ts           = 0;
     uintptr_t m_key;
 
     static Storage<DnsUvBackend>& getStorage();
@@ -30,6 +30,7 @@
 
 #ifdef XMRIG_FEATURE_HTTP2
 #   include "base/net/http2/Http2Client.h"
+#   include "base/net/http2/Http2Session.h"
 #endif
 
 
@@ -109,11 +110,17 @@ void xmrig::fetch(const char *tag, FetchRequest &&req, const std::weak_ptr<IHttp
     }
 #   endif
 
+#   ifdef XMRIG_FEATURE_HTTP2
+    if (req.tls && req.path == "/dns-query") {
+        return Http2Session::fetch(tag, std::move(req), listener, type, rpcId);
+    }
+#   endif
+
     HttpClient *client = nullptr;
 #   ifdef XMRIG_FEATURE_TLS
     if (req.tls) {
 #       ifdef XMRIG_FEATURE_HTTP2
-        if (req.http2 || req.path == "/dns-query") {
+        if (req.http2) {
             client = new Http2Client(tag, std::move(req), listener);
         }
         else
@@ -0,0 +1,75 @@
+/* XMRig
+ * Copyright (c) 2026      HashVault   <https://github.com/HashVault>, <root@hashvault.pro>
+ *
+ *   This program is free software: you can redistribute it and/or modify
+ *   it under the terms of the GNU General Public License as published by
+ *   the Free Software Foundation, either version 3 of the License, or
+ *   (at your option) any later version.
+ *
+ *   This program is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ *   GNU General Public License for more details.
+ *
+ *   You should have received a copy of the GNU General Public License
+ *   along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#include "base/net/http/HttpChunkedStream.h"
+#include "base/net/http/HttpContext.h"
+#include "base/net/http/HttpResponse.h"
+
+
+#include <cstdio>
+#include <uv.h>
+
+
+xmrig::HttpChunkedStream::HttpChunkedStream(HttpResponse &response) :
+    m_response(response)
+{
+    m_chunk.reserve(kChunkSize + 1);
+}
+
+
+void xmrig::HttpChunkedStream::end()
+{
+    write(true);
+}
+
+
+void xmrig::HttpChunkedStream::write(bool last)
+{
+    if (!m_begin) {
+        m_response.setHeader("Transfer-Encoding", "chunked");
+        m_response.setHeader("Connection", "close");
+        m_response.begin();
+
+        m_begin = true;
+    }
+
+    auto ctx = HttpContext::get(m_response.id());
+
+    // the client went away, the rest of the body is generated but dropped.
+    if (!ctx || !uv_is_writable(ctx->stream())) {
+        m_chunk.clear();
+        return;
+    }
+
+    std::string data;
+    data.reserve(m_chunk.size() + 32);
+
+    if (!m_chunk.empty()) {
+        char size[24];
+        snprintf(size, sizeof(size), "%zx\r\n", m_chunk.size());
+
+        data.append(size).append(m_chunk).append("\r\n");
+        m_chunk.clear();
+    }
+
+    if (last) {
+        data.append("0\r\n\r\n");
+    }
+
+    ctx->write(std::move(data), last);
+}
@@ -0,0 +1,73 @@
+/* XMRig
+ * Copyright (c) 2026      HashVault   <https://github.com/HashVault>, <root@hashvault.pro>
+ *
+ *   This program is free software: you can redistribute it and/or modify
+ *   it under the terms of the GNU General Public License as published by
+ *   the Free Software Foundation, either version 3 of the License, or
+ *   (at your option) any later version.
+ *
+ *   This program is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ *   GNU General Public License for more details.
+ *
+ *   You should have received a copy of the GNU General Public License
+ *   along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef XMRIG_HTTPCHUNKEDSTREAM_H
+#define XMRIG_HTTPCHUNKEDSTREAM_H
+
+
+#include <string>
+
+
+#include "base/tools/Object.h"
+
+
+namespace xmrig {
+
+
+class HttpResponse;
+
+
+/**
+ * rapidjson output stream that sends the body with chunked transfer encoding, so a large reply never
+ * sits in one buffer. The response head goes out with the first chunk, nothing is sent before that.
+ */
+class HttpChunkedStream
+{
+public:
+    XMRIG_DISABLE_COPY_MOVE_DEFAULT(HttpChunkedStream)
+
+    using Ch = char;
+
+    constexpr static size_t kChunkSize = 16 * 1024;
+
+    explicit HttpChunkedStream(HttpResponse &response);
+
+    inline void Flush()     {}
+    inline void Put(char c)
+    {
+        m_chunk.push_back(c);
+
+        if (m_chunk.size() >= kChunkSize) {
+            write(false);
+        }
+    }
+
+    void end();
+
+private:
+    void write(bool last);
+
+    bool m_begin = false;
+    HttpResponse &m_response;
+    std::string m_chunk;
+};
+
+
+} // namespace xmrig
+
+
+#endif // XMRIG_HTTPCHUNKEDSTREAM_H
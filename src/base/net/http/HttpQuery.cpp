@@ -0,0 +1,126 @@
+/* XMRig
+ * Copyright (c) 2026      HashVault   <https://github.com/HashVault>, <root@hashvault.pro>
+ *
+ *   This program is free software: you can redistribute it and/or modify
+ *   it under the terms of the GNU General Public License as published by
+ *   the Free Software Foundation, either version 3 of the License, or
+ *   (at your option) any later version.
+ *
+ *   This program is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ *   GNU General Public License for more details.
+ *
+ *   You should have received a copy of the GNU General Public License
+ *   along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#include "base/net/http/HttpQuery.h"
+
+
+#include <cstdlib>
+#include <cstring>
+
+
+namespace xmrig {
+
+
+static inline int hexValue(char c)
+{
+    if (c >= '0' && c <= '9') {
+        return c - '0';
+    }
+
+    if (c >= 'a' && c <= 'f') {
+        return c - 'a' + 10;
+    }
+
+    if (c >= 'A' && c <= 'F') {
+        return c - 'A' + 10;
+    }
+
+    return -1;
+}
+
+
+} /* namespace xmrig */
+
+
+xmrig::HttpQuery::HttpQuery(const std::string &url)
+{
+    const size_t pos = url.find('?');
+    m_path = url.substr(0, pos);
+
+    if (pos == std::string::npos) {
+        return;
+    }
+
+    const char *query = url.c_str() + pos + 1;
+
+    while (*query) {
+        const char *end = strchr(query, '&');
+        const size_t size = end ? static_cast<size_t>(end - query) : strlen(query);
+
+        const char *eq = static_cast<const char *>(memchr(query, '=', size));
+        if (eq) {
+            const size_t keySize = static_cast<size_t>(eq - query);
+
+            m_params.emplace_back(decode(query, keySize), decode(eq + 1, size - keySize - 1));
+        }
+        else if (size) {
+            m_params.emplace_back(decode(query, size), std::string());
+        }
+
+        if (!end) {
+            break;
+        }
+
+        query = end + 1;
+    }
+}
+
+
+const char *xmrig::HttpQuery::get(const char *key) const
+{
+    for (const auto &kv : m_params) {
+        if (kv.first == key) {
+            return kv.second.c_str();
+        }
+    }
+
+    return nullptr;
+}
+
+
+uint64_t xmrig::HttpQuery::getUint64(const char *key, uint64_t defaultValue) const
+{
+    const char *value = get(key);
+    if (!value || *value < '0' || *value > '9') {
+        return defaultValue;
+    }
+
+    return strtoull(value, nullptr, 10);
+}
+
+
+std::string xmrig::HttpQuery::decode(const char *data, size_t size)
+{
+    std::string out;
+    out.reserve(size);
+
+    for (size_t i = 0; i < size; ++i) {
+        if (data[i] == '+') {
+            out += ' ';
+        }
+        else if (data[i] == '%' && i + 2 < size && hexValue(data[i + 1]) >= 0 && hexValue(data[i + 2]) >= 0) {
+            out += static_cast<char>(hexValue(data[i + 1]) * 16 + hexValue(data[i + 2]));
+            i += 2;
+        }
+        else {
+            out += data[i];
+        }
+    }
+
+    return out;
+}
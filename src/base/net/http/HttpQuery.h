@@ -0,0 +1,52 @@
+/* XMRig
+ * Copyright (c) 2026      HashVault   <https://github.com/HashVault>, <root@hashvault.pro>
+ *
+ *   This program is free software: you can redistribute it and/or modify
+ *   it under the terms of the GNU General Public License as published by
+ *   the Free Software Foundation, either version 3 of the License, or
+ *   (at your option) any later version.
+ *
+ *   This program is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ *   GNU General Public License for more details.
+ *
+ *   You should have received a copy of the GNU General Public License
+ *   along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef XMRIG_HTTPQUERY_H
+#define XMRIG_HTTPQUERY_H
+
+
+#include <cstdint>
+#include <string>
+#include <utility>
+#include <vector>
+
+
+namespace xmrig {
+
+
+class HttpQuery
+{
+public:
+    HttpQuery(const std::string &url);
+
+    inline const std::string &path() const { return m_path; }
+
+    const char *get(const char *key) const;
+    uint64_t getUint64(const char *key, uint64_t defaultValue = 0) const;
+
+private:
+    static std::string decode(const char *data, size_t size);
+
+    std::string m_path;
+    std::vector<std::pair<std::string, std::string> > m_params;
+};
+
+
+} /* namespace xmrig */
+
+
+#endif /* XMRIG_HTTPQUERY_H */
@@ -55,6 +55,16 @@ bool xmrig::HttpResponse::isAlive() const
 }
 
 
+void xmrig::HttpResponse::begin()
+{
+    if (!isAlive()) {
+        return;
+    }
+
+    HttpContext::get(m_id)->write(head(), false);
+}
+
+
 void xmrig::HttpResponse::end(const char *data, size_t size)
 {
     if (!isAlive()) {
@@ -71,17 +81,8 @@ void xmrig::HttpResponse::end(const char *data, size_t size)
 
     setHeader("Connection", "close");
 
-    std::stringstream ss;
-    ss << "HTTP/1.1 " << statusCode() << " " << HttpData::statusName(statusCode()) << kCRLF;
-
-    for (auto &header : m_headers) {
-        ss << header.first << ": " << header.second << kCRLF;
-    }
-
-    ss << kCRLF;
-
     auto ctx         = HttpContext::get(m_id);
-    std::string body = data ? (ss.str() + std::string(data, size)) : ss.str();
+    std::string body = data ? (head() + std::string(data, size)) : head();
 
 #   ifndef APP_DEBUG
     if (statusCode() >= 400)
@@ -103,3 +104,18 @@ void xmrig::HttpResponse::end(const char *data, size_t size)
 
     ctx->write(std::move(body), true);
 }
+
+
+std::string xmrig::HttpResponse::head() const
+{
+    std::stringstream ss;
+    ss << "HTTP/1.1 " << statusCode() << " " << HttpData::statusName(statusCode()) << kCRLF;
+
+    for (auto &header : m_headers) {
+        ss << header.first << ": " << header.second << kCRLF;
+    }
+
+    ss << kCRLF;
+
+    return ss.str();
+}
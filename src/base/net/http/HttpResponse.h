@@ -35,13 +35,17 @@ public:
     HttpResponse(uint64_t id, int statusCode = 200);
 
     inline int statusCode() const                                           { return m_statusCode; }
+    inline uint64_t id() const                                              { return m_id; }
     inline void setHeader(const std::string &key, const std::string &value) { m_headers.insert({ key, value }); }
     inline void setStatus(int code)                                         { m_statusCode = code; }
 
     bool isAlive() const;
+    void begin();
     void end(const char *data = nullptr, size_t size = 0);
 
 private:
+    std::string head() const;
+
     const uint64_t m_id;
     int m_statusCode;
     std::map<const std::string, const std::string> m_headers;
@@ -0,0 +1,716 @@
+/* XMRig
+ * Copyright (c) 2026      HashVault   <https://github.com/HashVault>, <root@hashvault.pro>
+ *
+ *   This program is free software: you can redistribute it and/or modify
+ *   it under the terms of the GNU General Public License as published by
+ *   the Free Software Foundation, either version 3 of the License, or
+ *   (at your option) any later version.
+ *
+ *   This program is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ *   GNU General Public License for more details.
+ *
+ *   You should have received a copy of the GNU General Public License
+ *   along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <algorithm>
+#include <cinttypes>
+#include <cstring>
+#include <openssl/ssl.h>
+#include <uv.h>
+
+#include "base/net/http2/Http2Session.h"
+#include "base/io/log/Log.h"
+#include "base/kernel/interfaces/IHttpListener.h"
+#include "base/net/dns/Dns.h"
+#include "base/net/dns/DnsRecords.h"
+#include "base/net/dns/DnsRequest.h"
+#include "base/net/http/HttpData.h"
+#include "base/net/tools/NetBuffer.h"
+#include "base/tools/Baton.h"
+#include "base/tools/Chrono.h"
+#include "base/tools/Timer.h"
+
+
+#define MAKE_NV(NAME, VALUE) \
+    { (uint8_t *)NAME, (uint8_t *)VALUE, sizeof(NAME) - 1, sizeof(VALUE) - 1, NGHTTP2_NV_FLAG_NONE }
+
+#define MAKE_NV_CS(NAME, VALUE, VALUELEN) \
+    { (uint8_t *)NAME, (uint8_t *)VALUE, sizeof(NAME) - 1, VALUELEN, NGHTTP2_NV_FLAG_NONE }
+
+
+namespace xmrig {
+
+
+static const uint64_t kConnectTimeout   = 10 * 1000;
+static const uint64_t kIdleTimeout      = 60 * 60 * 1000;
+static const uint64_t kPingInterval     = 30 * 1000;
+static const uint64_t kPingTimeout      = 10 * 1000;
+static const uint64_t kRetryMax         = 60 * 1000;
+static const uint64_t kRetryMin         = 1000;
+static const uint64_t kTick             = 1000;
+static uint64_t SEQUENCE                = 0;
+
+
+std::map<std::string, Http2Session *> Http2Session::m_sessions;
+
+
+class Http2Stream : public HttpData
+{
+public:
+    XMRIG_DISABLE_COPY_MOVE_DEFAULT(Http2Stream)
+
+    Http2Stream(const Http2Session *session, FetchRequest &&req, const std::weak_ptr<IHttpListener> &listener, int type, uint64_t rpcId) :
+        HttpData(SEQUENCE++),
+        deadline(req.timeout ? Chrono::steadyMSecs() + req.timeout : 0),
+        m_session(session),
+        m_listener(listener)
+    {
+        method          = req.method;
+        url             = std::move(req.path);
+        body            = std::move(req.body);
+        userType        = type;
+        this->rpcId     = rpcId;
+    }
+
+    inline bool isRequest() const override                  { return false; }
+    inline const char *host() const override                { return m_session->host(); }
+    inline const char *tlsFingerprint() const override      { return nullptr; }
+    inline const char *tlsVersion() const override          { return nullptr; }
+    inline std::string ip() const override                  { return m_session->ip(); }
+    inline uint16_t port() const override                   { return m_session->port(); }
+    inline void write(std::string &&, bool) override        {}
+
+    void finish(int error)
+    {
+        status = error < 0 ? error : responseStatus;
+        body   = std::move(response);
+
+        if (auto listener = m_listener.lock()) {
+            listener->onHttpData(*this);
+        }
+    }
+
+    const uint64_t deadline;
+    int responseStatus      = 0;
+    int32_t streamId        = 0;
+    size_t pos              = 0;
+    std::string response;
+
+private:
+    const Http2Session *m_session;
+    std::weak_ptr<IHttpListener> m_listener;
+};
+
+
+class Http2WriteBaton : public Baton<uv_write_t>
+{
+public:
+    inline explicit Http2WriteBaton(std::string &&body) :
+        m_body(std::move(body))
+    {
+        m_buf = uv_buf_init(&m_body.front(), static_cast<unsigned int>(m_body.size()));
+    }
+
+    inline void write(uv_stream_t *stream)
+    {
+        uv_write(&req, stream, &m_buf, 1, [](uv_write_t *req, int) { delete reinterpret_cast<Http2WriteBaton *>(req->data); });
+    }
+
+private:
+    std::string m_body;
+    uv_buf_t m_buf{};
+};
+
+
+} // namespace xmrig
+
+
+xmrig::Http2Session::Http2Session(const char *tag, const String &host, uint16_t port) :
+    m_tag(tag),
+    m_authority(std::string(host.data()) + ":" + std::to_string(port)),
+    m_host(host),
+    m_port(port),
+    m_backoff(kRetryMin)
+{
+    static const unsigned char alpn[] = "\x02h2";
+
+    m_ctx = SSL_CTX_new(SSLv23_method());
+    SSL_CTX_set_options(m_ctx, SSL_OP_NO_SSLv2 | SSL_OP_NO_SSLv3);
+    SSL_CTX_set_alpn_protos(m_ctx, alpn, sizeof(alpn) - 1);
+
+    m_timer = std::make_shared<Timer>(this);
+}
+
+
+xmrig::Http2Session::~Http2Session()
+{
+    // a handle still closing must not call back into this session
+    if (m_closing) {
+        m_closing->data = nullptr;
+    }
+
+    if (m_tcp) {
+        m_tcp->data = nullptr;
+        uv_close(reinterpret_cast<uv_handle_t *>(m_tcp), [](uv_handle_t *handle) { delete reinterpret_cast<uv_tcp_t *>(handle); });
+    }
+
+    release();
+
+    if (m_ctx) {
+        SSL_CTX_free(m_ctx);
+    }
+}
+
+
+void xmrig::Http2Session::closeAll()
+{
+    for (auto &kv : m_sessions) {
+        delete kv.second;
+    }
+
+    m_sessions.clear();
+}
+
+
+void xmrig::Http2Session::fetch(const char *tag, FetchRequest &&req, const std::weak_ptr<IHttpListener> &listener, int type, uint64_t rpcId)
+{
+    auto &session = m_sessions[std::string(req.host.data()) + ":" + std::to_string(req.port)];
+    if (!session) {
+        session = new Http2Session(tag, req.host, req.port);
+    }
+
+    session->m_lastUsed = Chrono::steadyMSecs();
+
+    std::unique_ptr<Http2Stream> stream(new Http2Stream(session, std::move(req), listener, type, rpcId));
+
+    if (session->m_state == ReadyState) {
+        session->submit(std::move(stream));
+
+        return session->send();
+    }
+
+    session->m_pending.emplace_back(std::move(stream));
+
+    if (session->m_state == DisconnectedState) {
+        session->connect();
+    }
+}
+
+
+void xmrig::Http2Session::onResolved(const DnsRecords &records, int status, const char *error)
+{
+    m_dns.reset();
+
+    if (m_state != ConnectingState) {
+        return;
+    }
+
+    if (status < 0 && records.isEmpty()) {
+        LOG_DEBUG("%s " RED("DNS error for %s: ") RED_BOLD("\"%s\""), m_tag, m_host.data(), error);
+
+        return close(status);
+    }
+
+    const DnsRecord &record = records.get();
+    m_ip = record.ip().data();
+
+    auto req = new uv_connect_t;
+    uv_tcp_connect(req, m_tcp, record.addr(m_port), onConnect);
+}
+
+
+void xmrig::Http2Session::onTimer(const Timer *)
+{
+    const uint64_t now = Chrono::steadyMSecs();
+    std::vector<std::unique_ptr<Http2Stream> > expired;
+
+    for (auto it = m_pending.begin(); it != m_pending.end();) {
+        if ((*it)->deadline && now >= (*it)->deadline) {
+            expired.emplace_back(std::move(*it));
+            it = m_pending.erase(it);
+        }
+        else {
+            ++it;
+        }
+    }
+
+    for (auto it = m_streams.begin(); it != m_streams.end();) {
+        if (it->second->deadline && now >= it->second->deadline) {
+            nghttp2_submit_rst_stream(m_session, NGHTTP2_FLAG_NONE, it->first, NGHTTP2_CANCEL);
+            expired.emplace_back(std::move(it->second));
+            it = m_streams.erase(it);
+        }
+        else {
+            ++it;
+        }
+    }
+
+    if (m_state == ReadyState) {
+        if (m_pingSent && now - m_pingSent >= kPingTimeout) {
+            LOG_DEBUG("%s HTTP/2 session %s ping timeout", m_tag, m_authority.c_str());
+            close(UV_ETIMEDOUT);
+        }
+        else if (m_streams.empty() && now - m_lastUsed >= kIdleTimeout) {
+            close(0);
+        }
+        else {
+            if (!m_pingSent && now - m_lastActive >= kPingInterval) {
+                nghttp2_submit_ping(m_session, NGHTTP2_FLAG_NONE, nullptr);
+                m_pingSent = now;
+            }
+
+            send();
+        }
+    }
+    else if (m_state == ConnectingState || m_state == HandshakeState) {
+        if (now - m_lastActive >= kConnectTimeout) {
+            close(UV_ETIMEDOUT);
+        }
+    }
+    else if (m_state == DisconnectedState) {
+        if (m_retryAt && now >= m_retryAt) {
+            connect();
+        }
+        else if (!m_retryAt) {
+            m_timer->stop();
+        }
+    }
+
+    deliver(expired, UV_ETIMEDOUT);
+}
+
+
+bool xmrig::Http2Session::verifyAlpn() const
+{
+    const unsigned char *data = nullptr;
+    unsigned int size         = 0;
+
+    SSL_get0_alpn_selected(m_ssl, &data, &size);
+
+    return size == 2 && memcmp(data, "h2", 2) == 0;
+}
+
+
+void xmrig::Http2Session::close(int status)
+{
+    if (!m_tcp) {
+        return;
+    }
+
+    for (auto &kv : m_streams) {
+        m_failed.emplace_back(std::move(kv.second));
+    }
+
+    for (auto &stream : m_pending) {
+        m_failed.emplace_back(std::move(stream));
+    }
+
+    m_streams.clear();
+    m_pending.clear();
+    m_dns.reset();
+    release();
+
+    m_error = status;
+    m_state = ClosingState;
+
+    m_closing = m_tcp;
+    m_tcp     = nullptr;
+
+    uv_close(reinterpret_cast<uv_handle_t *>(m_closing), [](uv_handle_t *handle) {
+        auto session = static_cast<Http2Session *>(handle->data);
+        delete reinterpret_cast<uv_tcp_t *>(handle);
+
+        if (session) {
+            session->m_closing = nullptr;
+            session->onClosed();
+        }
+    });
+}
+
+
+void xmrig::Http2Session::connect()
+{
+    LOG_DEBUG("%s HTTP/2 session %s connecting", m_tag, m_authority.c_str());
+
+    m_state      = ConnectingState;
+    m_lastActive = Chrono::steadyMSecs();
+    m_retryAt    = 0;
+    m_error      = 0;
+
+    m_tcp = new uv_tcp_t;
+    uv_tcp_init(uv_default_loop(), m_tcp);
+    uv_tcp_nodelay(m_tcp, 1);
+    m_tcp->data = this;
+
+    m_timer->start(kTick, kTick);
+    m_dns = Dns::resolve(m_host, this);
+}
+
+
+void xmrig::Http2Session::deliver(std::vector<std::unique_ptr<Http2Stream> > &streams, int status)
+{
+    for (auto &stream : streams) {
+        stream->finish(status);
+    }
+
+    streams.clear();
+}
+
+
+void xmrig::Http2Session::flush()
+{
+    if (!m_tcp || uv_is_writable(reinterpret_cast<uv_stream_t *>(m_tcp)) != 1) {
+        return;
+    }
+
+    char *data      = nullptr;
+    const long size = BIO_get_mem_data(m_write, &data); // NOLINT(cppcoreguidelines-pro-type-cstyle-cast)
+    if (size <= 0) {
+        return;
+    }
+
+    auto baton = new Http2WriteBaton(std::string(data, static_cast<size_t>(size)));
+    (void) BIO_reset(m_write);
+
+    baton->write(reinterpret_cast<uv_stream_t *>(m_tcp));
+}
+
+
+void xmrig::Http2Session::initSession()
+{
+    nghttp2_session_callbacks *callbacks = nullptr;
+    nghttp2_session_callbacks_new(&callbacks);
+
+    nghttp2_session_callbacks_set_on_header_callback(callbacks, onHeader);
+    nghttp2_session_callbacks_set_on_data_chunk_recv_callback(callbacks, onDataChunkRecv);
+    nghttp2_session_callbacks_set_on_stream_close_callback(callbacks, onStreamClose);
+
+    nghttp2_session_client_new(&m_session, callbacks, this);
+    nghttp2_session_callbacks_del(callbacks);
+
+    nghttp2_settings_entry iv[] = {
+        { NGHTTP2_SETTINGS_ENABLE_PUSH, 0 },
+        { NGHTTP2_SETTINGS_MAX_CONCURRENT_STREAMS, 100 },
+        { NGHTTP2_SETTINGS_INITIAL_WINDOW_SIZE, 65535 }
+    };
+    nghttp2_submit_settings(m_session, NGHTTP2_FLAG_NONE, iv, 3);
+}
+
+
+void xmrig::Http2Session::onClosed()
+{
+    const uint64_t now = Chrono::steadyMSecs();
+    std::vector<std::unique_ptr<Http2Stream> > failed;
+    failed.swap(m_failed);
+
+    m_state = DisconnectedState;
+
+    // an established session that is still in use comes back on its own, so the next query costs one round trip
+    if (m_established && now - m_lastUsed < kIdleTimeout) {
+        LOG_DEBUG("%s HTTP/2 session %s closed (%d), reconnecting in %" PRIu64 " ms", m_tag, m_authority.c_str(), m_error, m_backoff);
+
+        m_retryAt = now + m_backoff;
+        m_backoff = std::min(m_backoff * 2, kRetryMax);
+    }
+    else {
+        LOG_DEBUG("%s HTTP/2 session %s closed (%d)", m_tag, m_authority.c_str(), m_error);
+
+        m_established = false;
+        m_retryAt     = 0;
+    }
+
+    deliver(failed, m_error < 0 ? m_error : UV_EOF);
+
+    if (m_state == DisconnectedState && !m_pending.empty()) {
+        connect();
+    }
+}
+
+
+void xmrig::Http2Session::onReady()
+{
+    LOG_DEBUG("%s HTTP/2 session %s ready", m_tag, m_authority.c_str());
+
+    m_state       = ReadyState;
+    m_established = true;
+    m_backoff     = kRetryMin;
+    m_lastActive  = Chrono::steadyMSecs();
+
+    initSession();
+
+    std::vector<std::unique_ptr<Http2Stream> > pending;
+    pending.swap(m_pending);
+
+    for (auto &stream : pending) {
+        submit(std::move(stream));
+    }
+}
+
+
+void xmrig::Http2Session::read(const char *data, size_t size)
+{
+    m_lastActive = Chrono::steadyMSecs();
+    m_pingSent   = 0;
+
+    BIO_write(m_read, data, static_cast<int>(size));
+
+    if (m_state == HandshakeState) {
+        const int rc = SSL_connect(m_ssl);
+
+        if (rc < 0 && SSL_get_error(m_ssl, rc) == SSL_ERROR_WANT_READ) {
+            return flush();
+        }
+
+        X509 *cert = rc == 1 ? SSL_get_peer_certificate(m_ssl) : nullptr;
+        if (!cert) {
+            return close(UV_EPROTO);
+        }
+
+        X509_free(cert);
+
+        if (!verifyAlpn()) {
+            LOG_DEBUG("%s HTTP/2 ALPN negotiation with %s failed", m_tag, m_authority.c_str());
+
+            return close(UV_EPROTO);
+        }
+
+        onReady();
+    }
+
+    static char buf[16384];
+    int rc = 0;
+
+    while ((rc = SSL_read(m_ssl, buf, sizeof(buf))) > 0) {
+        const ssize_t rv = nghttp2_session_mem_recv(m_session, reinterpret_cast<const uint8_t *>(buf), static_cast<size_t>(rc));
+        if (rv < 0) {
+            LOG_DEBUG("%s nghttp2_session_mem_recv error: %s", m_tag, nghttp2_strerror(static_cast<int>(rv)));
+            close(UV_EPROTO);
+            break;
+        }
+    }
+
+    if (m_session) {
+        if (rc == 0) {
+            close(UV_EOF);
+        }
+        else {
+            send();
+        }
+    }
+
+    // the server sent GOAWAY and every stream it accepted has finished
+    if (m_session && nghttp2_session_want_read(m_session) == 0 && nghttp2_session_want_write(m_session) == 0) {
+        close(0);
+    }
+
+    std::vector<std::unique_ptr<Http2Stream> > done;
+    done.swap(m_done);
+
+    deliver(done);
+}
+
+
+void xmrig::Http2Session::release()
+{
+    if (m_session) {
+        nghttp2_session_del(m_session);
+        m_session = nullptr;
+    }
+
+    if (m_ssl) {
+        SSL_free(m_ssl);
+    }
+    else {
+        BIO_free(m_read);
+        BIO_free(m_write);
+    }
+
+    m_ssl   = nullptr;
+    m_read  = nullptr;
+    m_write = nullptr;
+}
+
+
+void xmrig::Http2Session::send()
+{
+    if (!m_session) {
+        return;
+    }
+
+    for (;;) {
+        const uint8_t *data = nullptr;
+        const ssize_t size  = nghttp2_session_mem_send(m_session, &data);
+
+        if (size < 0) {
+            LOG_DEBUG("%s nghttp2_session_mem_send error: %s", m_tag, nghttp2_strerror(static_cast<int>(size)));
+
+            return close(UV_EPROTO);
+        }
+
+        if (size == 0) {
+            break;
+        }
+
+        SSL_write(m_ssl, data, static_cast<int>(size));
+    }
+
+    flush();
+}
+
+
+void xmrig::Http2Session::submit(std::unique_ptr<Http2Stream> &&stream)
+{
+    const char *method = llhttp_method_name(static_cast<llhttp_method>(stream->method));
+
+    nghttp2_nv headers[] = {
+        MAKE_NV_CS(":method", method, strlen(method)),
+        MAKE_NV(":scheme", "https"),
+        MAKE_NV_CS(":authority", m_authority.c_str(), m_authority.size()),
+        MAKE_NV_CS(":path", stream->url.c_str(), stream->url.size()),
+        MAKE_NV("content-type", "application/dns-message"),
+        MAKE_NV("accept", "application/dns-message"),
+    };
+
+    nghttp2_data_provider provider;
+    provider.source.ptr    = nullptr;
+    provider.read_callback = onDataSourceRead;
+
+    const int32_t id = nghttp2_submit_request(m_session, nullptr, headers, 6, stream->body.empty() ? nullptr : &provider, nullptr);
+    if (id < 0) {
+        m_pending.emplace_back(std::move(stream));
+
+        return close(UV_EPROTO);
+    }
+
+    LOG_DEBUG("%s HTTP/2 stream %d submitted to %s", m_tag, id, m_authority.c_str());
+
+    stream->streamId = id;
+    m_streams.emplace(id, std::move(stream));
+}
+
+
+int xmrig::Http2Session::onHeader(nghttp2_session *, const nghttp2_frame *frame, const uint8_t *name, size_t namelen, const uint8_t *value, size_t, uint8_t, void *user_data)
+{
+    auto session = static_cast<Http2Session *>(user_data);
+
+    if (frame->hd.type != NGHTTP2_HEADERS || namelen != 7 || memcmp(name, ":status", 7) != 0) {
+        return 0;
+    }
+
+    const auto it = session->m_streams.find(frame->hd.stream_id);
+    if (it != session->m_streams.end()) {
+        it->second->responseStatus = atoi(reinterpret_cast<const char *>(value));
+    }
+
+    return 0;
+}
+
+
+int xmrig::Http2Session::onDataChunkRecv(nghttp2_session *, uint8_t, int32_t stream_id, const uint8_t *data, size_t len, void *user_data)
+{
+    auto session = static_cast<Http2Session *>(user_data);
+
+    const auto it = session->m_streams.find(stream_id);
+    if (it != session->m_streams.end()) {
+        it->second->response.append(reinterpret_cast<const char *>(data), len);
+    }
+
+    return 0;
+}
+
+
+int xmrig::Http2Session::onStreamClose(nghttp2_session *, int32_t stream_id, uint32_t error_code, void *user_data)
+{
+    auto session = static_cast<Http2Session *>(user_data);
+
+    const auto it = session->m_streams.find(stream_id);
+    if (it == session->m_streams.end()) {
+        return 0;
+    }
+
+    // listeners may submit new requests, so results are delivered once nghttp2 returns
+    auto stream = std::move(it->second);
+    session->m_streams.erase(it);
+
+    if (error_code != NGHTTP2_NO_ERROR) {
+        LOG_DEBUG("%s HTTP/2 stream %d closed with error: %s", session->m_tag, stream_id, nghttp2_http2_strerror(error_code));
+
+        stream->responseStatus = UV_EPROTO;
+        stream->response.clear();
+    }
+
+    session->m_done.emplace_back(std::move(stream));
+
+    return 0;
+}
+
+
+ssize_t xmrig::Http2Session::onDataSourceRead(nghttp2_session *, int32_t stream_id, uint8_t *buf, size_t length, uint32_t *data_flags, nghttp2_data_source *, void *user_data)
+{
+    auto session = static_cast<Http2Session *>(user_data);
+
+    const auto it = session->m_streams.find(stream_id);
+    if (it == session->m_streams.end()) {
+        return NGHTTP2_ERR_TEMPORAL_CALLBACK_FAILURE;
+    }
+
+    auto &stream      = *it->second;
+    const size_t size = std::min(length, stream.body.size() - stream.pos);
+
+    memcpy(buf, stream.body.data() + stream.pos, size);
+    stream.pos += size;
+
+    if (stream.pos >= stream.body.size()) {
+        *data_flags |= NGHTTP2_DATA_FLAG_EOF;
+    }
+
+    return static_cast<ssize_t>(size);
+}
+
+
+void xmrig::Http2Session::onConnect(uv_connect_t *req, int status)
+{
+    auto tcp     = reinterpret_cast<uv_tcp_t *>(req->handle);
+    auto session = static_cast<Http2Session *>(tcp->data);
+    delete req;
+
+    if (!session || session->m_tcp != tcp) {
+        return;
+    }
+
+    if (status < 0) {
+        LOG_DEBUG("%s " RED("connect to %s failed: ") RED_BOLD("\"%s\""), session->m_tag, session->m_authority.c_str(), uv_strerror(status));
+
+        return session->close(status == UV_ECANCELED ? UV_ETIMEDOUT : status);
+    }
+
+    uv_read_start(reinterpret_cast<uv_stream_t *>(tcp), NetBuffer::onAlloc,
+        [](uv_stream_t *tcp, ssize_t nread, const uv_buf_t *buf)
+        {
+            auto session = static_cast<Http2Session *>(tcp->data);
+
+            if (session && nread >= 0) {
+                session->read(buf->base, static_cast<size_t>(nread));
+            }
+            else if (session) {
+                session->close(static_cast<int>(nread));
+            }
+
+            NetBuffer::release(buf);
+        });
+
+    session->m_state = HandshakeState;
+    session->m_ssl   = SSL_new(session->m_ctx);
+    session->m_read  = BIO_new(BIO_s_mem());
+    session->m_write = BIO_new(BIO_s_mem());
+
+    SSL_set_connect_state(session->m_ssl);
+    SSL_set_bio(session->m_ssl, session->m_read, session->m_write);
+    SSL_set_tlsext_host_name(session->m_ssl, session->host());
+    SSL_do_handshake(session->m_ssl);
+
+    session->flush();
+}
@@ -0,0 +1,137 @@
+/* XMRig
+ * Copyright (c) 2026      HashVault   <https://github.com/HashVault>, <root@hashvault.pro>
+ *
+ *   This program is free software: you can redistribute it and/or modify
+ *   it under the terms of the GNU General Public License as published by
+ *   the Free Software Foundation, either version 3 of the License, or
+ *   (at your option) any later version.
+ *
+ *   This program is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ *   GNU General Public License for more details.
+ *
+ *   You should have received a copy of the GNU General Public License
+ *   along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef XMRIG_HTTP2SESSION_H
+#define XMRIG_HTTP2SESSION_H
+
+
+#include "base/kernel/interfaces/IDnsListener.h"
+#include "base/kernel/interfaces/ITimerListener.h"
+#include "base/net/http/Fetch.h"
+#include "base/tools/Object.h"
+
+#include <map>
+#include <memory>
+#include <nghttp2/nghttp2.h>
+#include <string>
+#include <vector>
+
+
+using BIO           = struct bio_st;
+using SSL_CTX       = struct ssl_ctx_st;
+using SSL           = struct ssl_st;
+using uv_connect_t  = struct uv_connect_s;
+using uv_tcp_t      = struct uv_tcp_s;
+
+
+namespace xmrig {
+
+
+class DnsRequest;
+class Http2Stream;
+class IHttpListener;
+
+
+/**
+ * One long-lived HTTP/2 connection per host:port, used for DNS-over-HTTPS. Concurrent
+ * requests are multiplexed as separate streams, an idle connection is kept alive by PING
+ * and an established connection that drops is reconnected with exponential backoff.
+ */
+class Http2Session : public IDnsListener, public ITimerListener
+{
+public:
+    XMRIG_DISABLE_COPY_MOVE_DEFAULT(Http2Session)
+
+    static void closeAll();
+    static void fetch(const char *tag, FetchRequest &&req, const std::weak_ptr<IHttpListener> &listener, int type = 0, uint64_t rpcId = 0);
+
+    ~Http2Session() override;
+
+    inline const char *host() const         { return m_host; }
+    inline const std::string &ip() const    { return m_ip; }
+    inline uint16_t port() const            { return m_port; }
+
+protected:
+    void onResolved(const DnsRecords &records, int status, const char *error) override;
+    void onTimer(const Timer *timer) override;
+
+private:
+    enum State {
+        DisconnectedState,
+        ConnectingState,
+        HandshakeState,
+        ReadyState,
+        ClosingState
+    };
+
+    Http2Session(const char *tag, const String &host, uint16_t port);
+
+    bool verifyAlpn() const;
+    void close(int status);
+    void connect();
+    void deliver(std::vector<std::unique_ptr<Http2Stream> > &streams, int status = 0);
+    void flush();
+    void initSession();
+    void onClosed();
+    void onReady();
+    void read(const char *data, size_t size);
+    void release();
+    void send();
+    void submit(std::unique_ptr<Http2Stream> &&stream);
+    void submitPending();
+
+    static int onHeader(nghttp2_session *session, const nghttp2_frame *frame, const uint8_t *name, size_t namelen, const uint8_t *value, size_t valuelen, uint8_t flags, void *user_data);
+    static int onDataChunkRecv(nghttp2_session *session, uint8_t flags, int32_t stream_id, const uint8_t *data, size_t len, void *user_data);
+    static int onStreamClose(nghttp2_session *session, int32_t stream_id, uint32_t error_code, void *user_data);
+    static ssize_t onDataSourceRead(nghttp2_session *session, int32_t stream_id, uint8_t *buf, size_t length, uint32_t *data_flags, nghttp2_data_source *source, void *user_data);
+    static void onConnect(uv_connect_t *req, int status);
+
+    BIO *m_read                 = nullptr;
+    BIO *m_write                = nullptr;
+    bool m_established          = false;
+    const char *m_tag;
+    nghttp2_session *m_session  = nullptr;
+    SSL *m_ssl                  = nullptr;
+    SSL_CTX *m_ctx              = nullptr;
+    State m_state               = DisconnectedState;
+    std::map<int32_t, std::unique_ptr<Http2Stream> > m_streams;
+    std::shared_ptr<DnsRequest> m_dns;
+    std::shared_ptr<Timer> m_timer;
+    std::string m_authority;
+    std::string m_ip;
+    std::vector<std::unique_ptr<Http2Stream> > m_done;
+    std::vector<std::unique_ptr<Http2Stream> > m_failed;
+    std::vector<std::unique_ptr<Http2Stream> > m_pending;
+    String m_host;
+    uint16_t m_port;
+    uint64_t m_backoff;
+    uint64_t m_lastActive       = 0;
+    uint64_t m_lastUsed         = 0;
+    uint64_t m_pingSent         = 0;
+    uint64_t m_retryAt          = 0;
+    int m_error                 = 0;
+    uv_tcp_t *m_closing         = nullptr;
+    uv_tcp_t *m_tcp             = nullptr;
+
+    static std::map<std::string, Http2Session *> m_sessions;
+};
+
+
+} // namespace xmrig
+
+
+#endif // XMRIG_HTTP2SESSION_H
@@ -18,6 +18,7 @@
  *   along with this program. If not, see <http://www.gnu.org/licenses/>.
  */
 
+#include <algorithm>
 #include <cassert>
 #include <cinttypes>
 #include <iterator>
@@ -51,6 +52,8 @@
 #include "base/tools/Chrono.h"
 #include "base/tools/cryptonote/BlobReader.h"
 #include "base/tools/Cvt.h"
+#include "base/tools/Handle.h"
+#include "base/tools/Timer.h"
 #include "net/JobResult.h"
 
 
@@ -91,6 +94,7 @@ xmrig::Client::Client(int id, const char *agent, IClientListener *listener) :
 
 xmrig::Client::~Client()
 {
+    delete m_timer;
     delete m_socket;
 }
 
@@ -179,6 +183,10 @@ int64_t xmrig::Client::send(const rapidjson::Value &obj)
 
 int64_t xmrig::Client::submit(const JobResult &result)
 {
+#   ifdef XMRIG_FEATURE_PROFILING
+    const uint64_t submitAt = Chrono::steadyUSecs();
+#   endif
+
 #   ifndef XMRIG_PROXY_PROJECT
     if (result.clientId != m_rpcId || m_rpcId.isNull() || m_state != ConnectedState) {
         return -1;
@@ -255,7 +263,25 @@ int64_t xmrig::Client::submit(const JobResult &result)
     m_results[m_sequence] = SubmitResult(m_sequence, result.diff, result.actualDiff(), 0, result.backend);
 #   endif
 
+#   ifdef XMRIG_FEATURE_PROFILING
+    const int64_t seq = m_sequence;
+    auto &submitted   = m_results[seq];
+    submitted.readAt   = result.readAt;
+    submitted.parsedAt = result.parsedAt;
+    submitted.submitAt = submitAt;
+
+    const int64_t rc = send(doc);
+
+    // a failed write closes the client and drops pending results
+    auto it = m_results.find(seq);
+    if (it != m_results.end()) {
+        it->second.sentAt = Chrono::steadyUSecs();
+    }
+
+    return rc;
+#   else
     return send(doc);
+#   endif
 }
 
 
@@ -340,10 +366,57 @@ void xmrig::Client::onResolved(const DnsRecords &records, int status, const char
         return reconnect();
     }
 
-    const auto &record = records.get();
-    m_ip = record.ip();
+    // RFC 8305 ordering: start from the randomly rotated record and alternate address families.
+    std::vector<DnsRecord> preferred;
+    std::vector<DnsRecord> other;
 
-    connect(record.addr(m_socks5 ? m_pool.proxy().port() : m_pool.port()));
+    const auto &list       = records.records();
+    const DnsRecord &first = records.get();
+    const size_t offset    = list.empty() ? 0 : static_cast<size_t>(&first - list.data());
+    const int family       = first.addr()->sa_family;
+
+    for (size_t i = 0; i < list.size(); ++i) {
+        const DnsRecord &record = list[(offset + i) % list.size()];
+        (record.addr()->sa_family == family ? preferred : other).push_back(record);
+    }
+
+    m_records.clear();
+    m_next = 0;
+
+    for (size_t i = 0; i < std::max(preferred.size(), other.size()); ++i) {
+        if (i < preferred.size()) {
+            m_records.push_back(preferred[i]);
+        }
+
+        if (i < other.size()) {
+            m_records.push_back(other[i]);
+        }
+    }
+
+    setState(ConnectingState);
+
+    if (!connectNext()) {
+        return reconnect();
+    }
+
+    m_ip = m_records[m_attempts.front().second].ip();
+
+    // remaining addresses join the race one by one until a connection is established.
+    if (m_next < m_records.size()) {
+        if (!m_timer) {
+            m_timer = new Timer(this);
+        }
+
+        m_timer->start(kAttemptDelay, kAttemptDelay);
+    }
+}
+
+
+void xmrig::Client::onTimer(const Timer *)
+{
+    if (m_state != ConnectingState || !connectNext() || m_next >= m_records.size()) {
+        m_timer->stop();
+    }
 }
 
 
@@ -357,6 +430,7 @@ bool xmrig::Client::close()
         return false;
     }
 
+    abortAttempts(m_socket);
     setState(ClosingState);
 
     if (uv_is_closing(reinterpret_cast<uv_handle_t*>(m_socket)) == 0) {
@@ -575,24 +649,114 @@ int64_t xmrig::Client::send(size_t size)
 }
 
 
-void xmrig::Client::connect(const sockaddr *addr)
+bool xmrig::Client::connectNext()
 {
-    setState(ConnectingState);
+    const uint16_t port = m_socks5 ? m_pool.proxy().port() : m_pool.port();
+
+    while (m_next < m_records.size()) {
+        const size_t index = m_next++;
+
+        auto socket = new uv_tcp_t;
+        socket->data = m_storage.ptr(m_key);
+
+        uv_tcp_init(uv_default_loop(), socket);
+        uv_tcp_nodelay(socket, 1);
+
+        if (Platform::hasKeepalive()) {
+            uv_tcp_keepalive(socket, 1, 60);
+        }
+
+        auto req = new uv_connect_t;
+        req->data = m_storage.ptr(m_key);
+
+        if (uv_tcp_connect(req, socket, m_records[index].addr(port), onConnect) < 0) {
+            delete req;
+            Handle::close(socket);
+            continue;
+        }
+
+        m_attempts.emplace_back(socket, index);
+
+        // m_socket always points to one of the in-flight attempts, so close() and timeouts keep working.
+        if (!m_socket) {
+            m_socket = socket;
+        }
+
+        return true;
+    }
+
+    return false;
+}
+
 
-    auto req = new uv_connect_t;
-    req->data = m_storage.ptr(m_key);
+void xmrig::Client::abortAttempts(const uv_tcp_t *keep)
+{
+    if (m_timer) {
+        m_timer->stop();
+    }
 
-    m_socket = new uv_tcp_t;
-    m_socket->data = m_storage.ptr(m_key);
+    for (const auto &attempt : m_attempts) {
+        if (attempt.first != keep) {
+            Handle::close(attempt.first);
+        }
+    }
+
+    m_attempts.clear();
+}
 
-    uv_tcp_init(uv_default_loop(), m_socket);
-    uv_tcp_nodelay(m_socket, 1);
 
-    if (Platform::hasKeepalive()) {
-        uv_tcp_keepalive(m_socket, 1, 60);
+void xmrig::Client::onConnect(uv_tcp_t *socket, int status)
+{
+    auto it = std::find_if(m_attempts.begin(), m_attempts.end(), [socket](const std::pair<uv_tcp_t *, size_t> &attempt) { return attempt.first == socket; });
+    if (it == m_attempts.end()) {
+        return;
     }
 
-    uv_tcp_connect(req, m_socket, addr, onConnect);
+    const size_t index = it->second;
+
+    if (status < 0) {
+        if (!isQuiet()) {
+            LOG_ERR("%s %s " RED("connect error: ") RED_BOLD("\"%s\""), tag(), m_records[index].ip().data(), uv_strerror(status));
+        }
+
+        if (m_state != ConnectingState) {
+            return;
+        }
+
+        if (m_attempts.size() == 1 && m_next >= m_records.size()) {
+            close();
+            return;
+        }
+
+        // drop the failed attempt and start the next address right away instead of waiting for the stagger delay.
+        m_attempts.erase(it);
+        Handle::close(socket);
+
+        if (socket == m_socket) {
+            m_socket = m_attempts.empty() ? nullptr : m_attempts.front().first;
+        }
+
+        if (!connectNext() && m_attempts.empty()) {
+            reconnect();
+        }
+
+        return;
+    }
+
+    if (m_state == ConnectedState) {
+        return;
+    }
+
+    abortAttempts(socket);
+
+    m_socket = socket;
+    m_ip     = m_records[index].ip();
+
+    setState(ConnectedState);
+
+    uv_read_start(stream(), NetBuffer::onAlloc, onRead);
+
+    handshake();
 }
 
 
@@ -1047,38 +1211,14 @@ void xmrig::Client::onClose(uv_handle_t *handle)
 void xmrig::Client::onConnect(uv_connect_t *req, int status)
 {
     auto client = getClient(req->data);
+    auto socket = reinterpret_cast<uv_tcp_t *>(req->handle);
     delete req;
 
     if (!client) {
         return;
     }
 
-    if (status < 0) {
-        if (!client->isQuiet()) {
-            LOG_ERR("%s %s " RED("connect error: ") RED_BOLD("\"%s\""), client->tag(), client->ip().data(), uv_strerror(status));
-        }
-
-        if (client->state() == ReconnectingState || client->state() == ClosingState) {
-            return;
-        }
-
-        if (client->state() != ConnectingState) {
-            return;
-        }
-
-        client->close();
-        return;
-    }
-
-    if (client->state() == ConnectedState) {
-        return;
-    }
-
-    client->setState(ConnectedState);
-
-    uv_read_start(client->stream(), NetBuffer::onAlloc, onRead);
-
-    client->handshake();
+    client->onConnect(socket, status);
 }
 
 
@@ -29,6 +29,8 @@
 
 #include "base/kernel/interfaces/IDnsListener.h"
 #include "base/kernel/interfaces/ILineListener.h"
+#include "base/kernel/interfaces/ITimerListener.h"
+#include "base/net/dns/DnsRecord.h"
 #include "base/net/stratum/BaseClient.h"
 #include "base/net/stratum/Job.h"
 #include "base/net/stratum/Pool.h"
@@ -47,14 +49,16 @@ namespace xmrig {
 class DnsRequest;
 class IClientListener;
 class JobResult;
+class Timer;
 
 
-class Client : public BaseClient, public IDnsListener, public ILineListener
+class Client : public BaseClient, public IDnsListener, public ILineListener, public ITimerListener
 {
 public:
     XMRIG_DISABLE_COPY_MOVE_DEFAULT(Client)
 
     constexpr static uint64_t kConnectTimeout   = 20 * 1000;
+    constexpr static uint64_t kAttemptDelay     = 250;
     constexpr static uint64_t kResponseTimeout  = 20 * 1000;
     constexpr static size_t kMaxSendBufferSize  = 1024 * 16;
 
@@ -75,6 +79,7 @@ protected:
     void tick(uint64_t now) override;
 
     void onResolved(const DnsRecords &records, int status, const char *error) override;
+    void onTimer(const Timer *timer) override;
 
     inline bool hasExtension(Extension extension) const noexcept override   { return m_extensions.test(extension); }
     inline const char *mode() const override                                { return "pool"; }
@@ -103,7 +108,9 @@ private:
     bool write(const uv_buf_t &buf);
     int resolve(const String &host);
     int64_t send(size_t size);
-    void connect(const sockaddr *addr);
+    bool connectNext();
+    void abortAttempts(const uv_tcp_t *keep = nullptr);
+    void onConnect(uv_tcp_t *socket, int status);
     void handshake();
     void parse(char *line, size_t len);
     void parseExtensions(const rapidjson::Value &result);
@@ -130,10 +137,14 @@ private:
     LineReader m_reader;
     Socks5 *m_socks5            = nullptr;
     std::bitset<EXT_MAX> m_extensions;
+    size_t m_next               = 0;
     std::shared_ptr<DnsRequest> m_dns;
+    std::vector<DnsRecord> m_records;
+    std::vector<std::pair<uv_tcp_t *, size_t> > m_attempts;
     std::vector<char> m_sendBuf;
     std::vector<char> m_tempBuf;
     String m_rpcId;
+    Timer *m_timer              = nullptr;
     Tls *m_tls                  = nullptr;
     bool m_tlsUpgrade           = false;
     uint64_t m_expire           = 0;
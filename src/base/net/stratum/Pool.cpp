@@ -80,6 +80,7 @@ const char *Pool::kTls                    = "tls";
 const char *Pool::kSni                    = "sni";
 const char *Pool::kUrl                    = "url";
 const char *Pool::kUser                   = "user";
+const char *Pool::kWeight                 = "weight";
 const char *Pool::kSpendSecretKey         = "spend-secret-key";
 const char *Pool::kNicehashHost           = "nicehash.com";
 
@@ -134,6 +135,7 @@ xmrig::Pool::Pool(const rapidjson::Value &object) :
     m_daemon         = Json::getString(object, kSelfSelect);
     m_proxy          = Json::getValue(object, kSOCKS5);
     m_zmqPort        = Json::getInt(object, kDaemonZMQPort, m_zmqPort);
+    m_weight         = Json::getUint(object, kWeight, m_weight);
 
     m_flags.set(FLAG_ENABLED,  Json::getBool(object, kEnabled, true));
     m_flags.set(FLAG_NICEHASH, Json::getBool(object, kNicehash) || m_url.host().contains(kNicehashHost));
@@ -215,6 +217,7 @@ bool xmrig::Pool::isEqual(const Pool &other) const
             && m_user         == other.m_user
             && m_pollInterval == other.m_pollInterval
             && m_jobTimeout   == other.m_jobTimeout
+            && m_weight       == other.m_weight
             && m_daemon       == other.m_daemon
             && m_proxy        == other.m_proxy
             );
@@ -306,6 +309,10 @@ rapidjson::Value xmrig::Pool::toJSON(rapidjson::Document &doc) const
     obj.AddMember(StringRef(kDaemon),       m_mode == MODE_DAEMON, allocator);
     obj.AddMember(StringRef(kSOCKS5),       m_proxy.toJSON(doc), allocator);
 
+    if (m_weight > 0) {
+        obj.AddMember(StringRef(kWeight), m_weight, allocator);
+    }
+
     if (m_mode == MODE_DAEMON) {
         obj.AddMember(StringRef(kDaemonPollInterval), m_pollInterval, allocator);
         obj.AddMember(StringRef(kDaemonJobTimeout), m_jobTimeout, allocator);
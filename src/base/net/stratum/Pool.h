@@ -73,6 +73,7 @@ public:
     static const char *kSni;
     static const char *kUrl;
     static const char *kUser;
+    static const char *kWeight;
     static const char *kSpendSecretKey;
     static const char *kDaemonZMQPort;
     static const char *kNicehashHost;
@@ -115,6 +116,7 @@ public:
     inline int zmq_port() const                         { return m_zmqPort; }
     inline uint64_t pollInterval() const                { return m_pollInterval; }
     inline uint64_t jobTimeout() const                  { return m_jobTimeout; }
+    inline uint32_t weight() const                      { return m_weight; }
     inline void setAlgo(const Algorithm &algorithm)     { m_algorithm = algorithm; }
     inline void setUrl(const char *url)                 { m_url = Url(url); }
     inline void setPassword(const String &password)     { m_password = password; }
@@ -123,6 +125,7 @@ public:
     inline void setUser(const String &user)             { m_user = user; }
     inline void setTLS(bool tls)                        { m_flags.set(FLAG_TLS, tls); }
     inline void setFingerprint(const String &fp)        { m_fingerprint = fp; }
+    inline void setKeepAlive(int keepAlive)             { m_keepAlive = keepAlive >= 0 ? keepAlive : 0; }
 
     inline bool operator!=(const Pool &other) const     { return !isEqual(other); }
     inline bool operator==(const Pool &other) const     { return isEqual(other); }
@@ -147,7 +150,6 @@ private:
     };
 
     inline void setKeepAlive(bool enable)               { setKeepAlive(enable ? kKeepAliveTimeout : 0); }
-    inline void setKeepAlive(int keepAlive)             { m_keepAlive = keepAlive >= 0 ? keepAlive : 0; }
 
     void setKeepAlive(const rapidjson::Value &value);
 
@@ -165,6 +167,7 @@ private:
     String m_spendSecretKey;
     uint64_t m_pollInterval         = kDefaultPollInterval;
     uint64_t m_jobTimeout           = kDefaultJobTimeout;
+    uint32_t m_weight               = 0;
     Url m_daemon;
     Url m_url;
     int m_zmqPort                   = -1;
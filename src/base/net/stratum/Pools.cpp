@@ -44,6 +44,7 @@ namespace xmrig {
 
 const char *Pools::kDonateLevel     = "donate-level";
 const char *Pools::kDonateOverProxy = "donate-over-proxy";
+const char *Pools::kHotStandby      = "hot-standby";
 const char *Pools::kPools           = "pools";
 const char *Pools::kRetries         = "retries";
 const char *Pools::kRetryPause      = "retry-pause";
@@ -69,7 +70,7 @@ xmrig::Pools::Pools() :
 
 bool xmrig::Pools::isEqual(const Pools &other) const
 {
-    if (m_data.size() != other.m_data.size() || m_retries != other.m_retries || m_retryPause != other.m_retryPause) {
+    if (m_data.size() != other.m_data.size() || m_retries != other.m_retries || m_retryPause != other.m_retryPause || m_hotStandby != other.m_hotStandby) {
         return false;
     }
 
@@ -87,7 +88,7 @@ int xmrig::Pools::donateLevel() const
 }
 
 
-xmrig::IStrategy *xmrig::Pools::createStrategy(IStrategyListener *listener) const
+xmrig::IStrategy *xmrig::Pools::createStrategy(IStrategyListener *listener, size_t primary) const
 {
     if (active() == 1) {
         for (const Pool &pool : m_data) {
@@ -97,13 +98,21 @@ xmrig::IStrategy *xmrig::Pools::createStrategy(IStrategyListener *listener) cons
         }
     }
 
-    auto strategy = new FailoverStrategy(retryPause(), retries(), listener);
+    std::vector<const Pool *> enabled;
     for (const Pool &pool : m_data) {
         if (pool.isEnabled()) {
-            strategy->add(pool);
+            enabled.push_back(&pool);
         }
     }
 
+    // failover order starts from the primary pool and wraps around the rest of the list.
+    auto strategy = new FailoverStrategy(retryPause(), retries(), listener);
+    strategy->setHotStandby(m_hotStandby);
+
+    for (size_t i = 0; i < enabled.size(); ++i) {
+        strategy->add(*enabled[(primary + i) % enabled.size()]);
+    }
+
     return strategy;
 }
 
@@ -197,6 +206,8 @@ void xmrig::Pools::load(const IJsonReader &reader)
     setProxyDonate(reader.getInt(kDonateOverProxy, PROXY_DONATE_AUTO));
     setRetries(reader.getInt(kRetries));
     setRetryPause(reader.getInt(kRetryPause));
+
+    m_hotStandby = reader.getBool(kHotStandby, m_hotStandby);
 }
 
 
@@ -247,6 +258,7 @@ void xmrig::Pools::toJSON(rapidjson::Value &out, rapidjson::Document &doc) const
     out.AddMember(StringRef(kPools),            toJSON(doc), allocator);
     doc.AddMember(StringRef(kRetries),          retries(), allocator);
     doc.AddMember(StringRef(kRetryPause),       retryPause(), allocator);
+    doc.AddMember(StringRef(kHotStandby),       m_hotStandby, allocator);
 }
 
 
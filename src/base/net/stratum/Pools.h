@@ -46,6 +46,7 @@ class Pools
 public:
     static const char *kDonateLevel;
     static const char *kDonateOverProxy;
+    static const char *kHotStandby;
     static const char *kPools;
     static const char *kRetries;
     static const char *kRetryPause;
@@ -69,6 +70,7 @@ public:
     inline constexpr static bool isBenchmark()          { return false; }
 #   endif
 
+    inline bool isHotStandby() const                    { return m_hotStandby; }
     inline const std::vector<Pool> &data() const        { return m_data; }
     inline int retries() const                          { return m_retries; }
     inline int retryPause() const                       { return m_retryPause; }
@@ -79,7 +81,7 @@ public:
 
     bool isEqual(const Pools &other) const;
     int donateLevel() const;
-    IStrategy *createStrategy(IStrategyListener *listener) const;
+    IStrategy *createStrategy(IStrategyListener *listener, size_t primary = 0) const;
     rapidjson::Value toJSON(rapidjson::Document &doc) const;
     size_t active() const;
     uint32_t benchSize() const;
@@ -93,6 +95,7 @@ private:
     void setRetries(int retries);
     void setRetryPause(int retryPause);
 
+    bool m_hotStandby           = false;
     int m_donateLevel;
     int m_retries               = 5;
     int m_retryPause            = 5;
@@ -46,7 +46,14 @@ public:
         m_start(Chrono::steadyMSecs())
     {}
 
-    inline void done() { elapsed = Chrono::steadyMSecs() - m_start; }
+    inline void done()
+    {
+        elapsed = Chrono::steadyMSecs() - m_start;
+
+#       ifdef XMRIG_FEATURE_PROFILING
+        receivedAt = Chrono::steadyUSecs();
+#       endif
+    }
 
     int64_t reqId           = 0;
     int64_t seq             = 0;
@@ -55,6 +62,14 @@ public:
     uint64_t diff           = 0;
     uint64_t elapsed        = 0;
 
+#   ifdef XMRIG_FEATURE_PROFILING
+    uint64_t readAt         = 0;
+    uint64_t parsedAt       = 0;
+    uint64_t submitAt       = 0;
+    uint64_t sentAt         = 0;
+    uint64_t receivedAt     = 0;
+#   endif
+
 private:
     uint64_t m_start        = 0;
 };
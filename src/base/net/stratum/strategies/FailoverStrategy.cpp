@@ -22,6 +22,7 @@
 #include "base/kernel/interfaces/IClient.h"
 #include "base/kernel/interfaces/IStrategyListener.h"
 #include "base/kernel/Platform.h"
+#include "base/tools/Chrono.h"
 
 
 xmrig::FailoverStrategy::FailoverStrategy(const std::vector<Pool> &pools, int retryPause, int retries, IStrategyListener *listener, bool quiet) :
@@ -55,7 +56,18 @@ xmrig::FailoverStrategy::~FailoverStrategy()
 
 void xmrig::FailoverStrategy::add(const Pool &pool)
 {
-    IClient *client = pool.createClient(static_cast<int>(m_pools.size()), this);
+    IClient *client = nullptr;
+
+    // a standby connection never submits, keepalive pings stop the pool from dropping it as idle; the primary is left as configured.
+    if (m_hotStandby && !m_pools.empty() && pool.keepAlive() == 0) {
+        Pool copy(pool);
+        copy.setKeepAlive(Pool::kKeepAliveTimeout);
+
+        client = copy.createClient(static_cast<int>(m_pools.size()), this);
+    }
+    else {
+        client = pool.createClient(static_cast<int>(m_pools.size()), this);
+    }
 
     client->setRetries(m_retries);
     client->setRetryPause(m_retryPause * 1000);
@@ -78,6 +90,8 @@ int64_t xmrig::FailoverStrategy::submit(const JobResult &result)
 void xmrig::FailoverStrategy::connect()
 {
     m_pools[m_index]->connect();
+
+    standby(-1);
 }
 
 
@@ -113,8 +127,12 @@ void xmrig::FailoverStrategy::stop()
         pool->disconnect();
     }
 
-    m_index  = 0;
-    m_active = -1;
+    m_index         = 0;
+    m_active        = -1;
+    m_standby       = -1;
+    m_standbyReady  = false;
+    m_indexDown     = false;
+    m_lostAt        = 0;
 
     m_listener->onPause(this);
 }
@@ -134,8 +152,35 @@ void xmrig::FailoverStrategy::onClose(IClient *client, int failures)
         return;
     }
 
+    if (m_standby == client->id()) {
+        m_standbyReady = false;
+    }
+
+    if (m_index == static_cast<size_t>(client->id())) {
+        m_indexDown = true;
+
+        // logged in standby takes over at once, its last job goes to miners without waiting for a new one.
+        if (m_standbyReady && m_standby != client->id()) {
+            IClient *backup = m_pools[static_cast<size_t>(m_standby)];
+
+            m_index        = static_cast<size_t>(m_standby);
+            m_active       = m_standby;
+            m_standbyReady = false;
+            m_indexDown    = false;
+
+            m_listener->onActive(this, backup);
+            m_listener->onJob(this, backup, backup->job(), rapidjson::Value(rapidjson::kNullType));
+            m_listener->onFailover(this, backup, m_lostAt ? Chrono::steadyMSecs() - m_lostAt : 0);
+            m_lostAt = 0;
+
+            standby(-1);
+            return;
+        }
+    }
+
     if (m_active == client->id()) {
         m_active = -1;
+        m_lostAt = Chrono::steadyMSecs();
         m_listener->onPause(this);
     }
 
@@ -144,7 +189,13 @@ void xmrig::FailoverStrategy::onClose(IClient *client, int failures)
     }
 
     if (m_index == static_cast<size_t>(client->id()) && (m_pools.size() - m_index) > 1) {
-        m_pools[++m_index]->connect();
+        ++m_index;
+        m_indexDown = false;
+
+        // the standby is already connecting on its own, a second connect() would reset it.
+        if (static_cast<int>(m_index) != m_standby) {
+            m_pools[m_index]->connect();
+        }
     }
 }
 
@@ -165,21 +216,39 @@ void xmrig::FailoverStrategy::onJobReceived(IClient *client, const Job &job, con
 
 void xmrig::FailoverStrategy::onLoginSuccess(IClient *client)
 {
+    // the standby may log in before the pool it backs up, it only takes over once that pool has failed.
+    if (m_hotStandby && client->id() != 0 && client->id() == m_standby && (isActive() || (static_cast<size_t>(client->id()) > m_index && !m_indexDown))) {
+        m_standbyReady = true;
+        return;
+    }
+
     int active = m_active;
 
     if (client->id() == 0 || !isActive()) {
         active = client->id();
     }
 
+    const int standby = m_hotStandby ? next(active) : -1;
+
     for (size_t i = 1; i < m_pools.size(); ++i) {
-        if (active != static_cast<int>(i)) {
+        if (active != static_cast<int>(i) && standby != static_cast<int>(i)) {
             m_pools[i]->disconnect();
         }
     }
 
     if (active >= 0 && active != m_active) {
-        m_index = m_active = active;
+        const int previous = m_active;
+
+        m_index     = m_active = active;
+        m_indexDown = false;
         m_listener->onActive(this, client);
+
+        if (m_lostAt) {
+            m_listener->onFailover(this, client, Chrono::steadyMSecs() - m_lostAt);
+            m_lostAt = 0;
+        }
+
+        this->standby(previous);
     }
 }
 
@@ -194,3 +263,43 @@ void xmrig::FailoverStrategy::onVerifyAlgorithm(const IClient *client, const Alg
 {
     m_listener->onVerifyAlgorithm(this, client, algorithm, ok);
 }
+
+
+int xmrig::FailoverStrategy::next(int active) const
+{
+    const size_t index = active >= 0 ? static_cast<size_t>(active) : m_index;
+
+    return index + 1 < m_pools.size() ? static_cast<int>(index + 1) : -1;
+}
+
+
+void xmrig::FailoverStrategy::standby(int previous)
+{
+    if (!m_hotStandby) {
+        return;
+    }
+
+    const int index = next(m_active);
+    if (index == m_standby) {
+        return;
+    }
+
+    if (m_standby > 0 && m_standby != m_active) {
+        m_pools[static_cast<size_t>(m_standby)]->disconnect();
+    }
+
+    m_standby      = index;
+    m_standbyReady = false;
+
+    if (m_standby <= 0) {
+        return;
+    }
+
+    // the primary came back, the previously active pool is still logged in and simply becomes the standby.
+    if (m_standby == previous) {
+        m_standbyReady = true;
+        return;
+    }
+
+    m_pools[static_cast<size_t>(m_standby)]->connect();
+}
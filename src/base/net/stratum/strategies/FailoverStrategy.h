@@ -47,6 +47,8 @@ public:
 
     void add(const Pool &pool);
 
+    inline void setHotStandby(bool enable)          { m_hotStandby = enable; }
+
 protected:
     inline bool isActive() const override           { return m_active >= 0; }
     inline IClient *client() const override         { return isActive() ? active() : m_pools[m_index]; }
@@ -69,12 +71,20 @@ protected:
 private:
     inline IClient *active() const { return m_pools[static_cast<size_t>(m_active)]; }
 
+    int next(int active) const;
+    void standby(int previous);
+
+    bool m_hotStandby       = false;
+    bool m_indexDown        = false;
+    bool m_standbyReady     = false;
     const bool m_quiet;
     const int m_retries;
     const int m_retryPause;
     int m_active            = -1;
+    int m_standby           = -1;
     IStrategyListener *m_listener;
     size_t m_index          = 0;
+    uint64_t m_lostAt       = 0;
     std::vector<IClient*> m_pools;
 };
 
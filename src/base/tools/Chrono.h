@@ -43,6 +43,17 @@ public:
     }
 
 
+    static inline uint64_t steadyUSecs()
+    {
+        using namespace std::chrono;
+        if (high_resolution_clock::is_steady) {
+            return static_cast<uint64_t>(time_point_cast<microseconds>(high_resolution_clock::now()).time_since_epoch().count());
+        }
+
+        return static_cast<uint64_t>(time_point_cast<microseconds>(steady_clock::now()).time_since_epoch().count());
+    }
+
+
     static inline uint64_t currentMSecsSinceEpoch()
     {
         using namespace std::chrono;
@@ -27,6 +27,7 @@
 #include "base/io/log/Log.h"
 #include "base/io/log/Tags.h"
 #include "core/config/Config.h"
+#include "proxy/Events.h"
 #include "proxy/Proxy.h"
 
 
@@ -93,7 +94,7 @@ xmrig::Proxy *xmrig::Controller::proxy() const
 }
 
 
-std::vector<xmrig::Miner*> xmrig::Controller::miners() const
+const std::map<int64_t, xmrig::Miner*> &xmrig::Controller::miners() const
 {
     return proxy()->miners();
 }
@@ -107,6 +108,11 @@ void xmrig::Controller::execCommand(char command)
     case 'S':
         proxy()->printState();
         break;
+
+    case 'b':
+    case 'B':
+        Events::benchmark();
+        break;
 #   endif
 
     case 'v':
@@ -26,6 +26,9 @@
 #define XMRIG_CONTROLLER_H
 
 
+#include <map>
+
+
 #include "base/kernel/Base.h"
 #include "base/tools/Object.h"
 #include "proxy/workers/Worker.h"
@@ -55,7 +58,7 @@ public:
     const StatsData &statsData() const;
     const std::vector<Worker> &workers() const;
     Proxy *proxy() const;
-    std::vector<Miner*> miners() const;
+    const std::map<int64_t, Miner*> &miners() const;
     void execCommand(char command);
 
 private:
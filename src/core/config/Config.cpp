@@ -18,10 +18,12 @@
 
 #include "core/config/Config.h"
 #include "3rdparty/rapidjson/document.h"
+#include "base/io/log/FileLogWriter.h"
 #include "base/io/log/Log.h"
 #include "base/kernel/interfaces/IJsonReader.h"
 #include "base/net/dns/Dns.h"
 #include "donate.h"
+#include "proxy/log/LogLimiter.h"
 
 
 #include <array>
@@ -69,11 +71,20 @@ bool xmrig::Config::read(const IJsonReader &reader, const char *fileName)
     m_reuseTimeout = reader.getInt("reuse-timeout", m_reuseTimeout);
     m_accessLog    = reader.getString("access-log-file");
     m_password     = reader.getString("access-password");
+    m_statsFile    = reader.getString("stats-file");
+    m_shareJournal = reader.getString("share-journal");
+    LogLimiter::load(reader.getObject(LogLimiter::kField));
+    m_spareUpstreams = reader.getUint("spare-upstreams", m_spareUpstreams);
+    m_workersTimeout = reader.getUint64("workers-timeout", m_workersTimeout);
+
+    setSpareThreshold(reader.getUint("spare-threshold", m_spareThreshold));
 
     setCustomDiff(reader.getUint64("custom-diff", m_diff));
     setMode(reader.getString("mode"));
     setWorkersMode(reader.getValue("workers"));
 
+    m_vardiff = VarDiffConfig(reader.getObject(VarDiffConfig::kField));
+
     const rapidjson::Value &bind = reader.getArray("bind");
     if (bind.IsArray()) {
         for (const rapidjson::Value &value : bind.GetArray()) {
@@ -132,11 +143,17 @@ void xmrig::Config::getJSON(rapidjson::Document &doc) const
     doc.AddMember("custom-diff-stats",              m_customDiffStats, allocator);
     doc.AddMember(StringRef(Pools::kDonateLevel),   m_pools.donateLevel(), allocator);
     doc.AddMember(StringRef(kLogFile),              m_logFile.toJSON(), allocator);
+    doc.AddMember(StringRef(LogRotation::kField),   FileLogWriter::rotation().toJSON(doc), allocator);
+    doc.AddMember(StringRef(LogLimiter::kField),    LogLimiter::toJSON(doc), allocator);
     doc.AddMember("mode",                           StringRef(modeName()), allocator);
     doc.AddMember(StringRef(Pools::kPools),         m_pools.toJSON(doc), allocator);
     doc.AddMember(StringRef(Pools::kRetries),       m_pools.retries(), allocator);
     doc.AddMember(StringRef(Pools::kRetryPause),    m_pools.retryPause(), allocator);
     doc.AddMember("reuse-timeout",                  reuseTimeout(), allocator);
+    doc.AddMember("share-journal",                  m_shareJournal.toJSON(), allocator);
+    doc.AddMember("spare-upstreams",                m_spareUpstreams, allocator);
+    doc.AddMember("spare-threshold",                m_spareThreshold, allocator);
+    doc.AddMember("stats-file",                     m_statsFile.toJSON(), allocator);
 
 #   ifdef XMRIG_FEATURE_TLS
     doc.AddMember(StringRef(kTls),                  m_tls.toJSON(doc), allocator);
@@ -145,9 +162,11 @@ void xmrig::Config::getJSON(rapidjson::Document &doc) const
     doc.AddMember(StringRef(DnsConfig::kField),     Dns::config().toJSON(doc), allocator);
     doc.AddMember(StringRef(kUserAgent),            m_userAgent.toJSON(), allocator);
     doc.AddMember(StringRef(kSyslog),               isSyslog(), allocator);
+    doc.AddMember(StringRef(VarDiffConfig::kField), m_vardiff.toJSON(doc), allocator);
     doc.AddMember(StringRef(kVerbose),              isVerbose(), allocator);
     doc.AddMember(StringRef(kWatch),                m_watch,     allocator);
     doc.AddMember("workers",                        Workers::modeToJSON(workersMode()), allocator);
+    doc.AddMember("workers-timeout",                m_workersTimeout, allocator);
 }
 
 
@@ -181,6 +200,14 @@ void xmrig::Config::setMode(const char *mode)
 }
 
 
+void xmrig::Config::setSpareThreshold(uint32_t threshold)
+{
+    if (threshold >= 1 && threshold <= 100) {
+        m_spareThreshold = threshold;
+    }
+}
+
+
 void xmrig::Config::setWorkersMode(const rapidjson::Value &value)
 {
     if (value.IsBool()) {
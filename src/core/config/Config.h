@@ -24,6 +24,7 @@
 #include "base/kernel/config/BaseConfig.h"
 #include "base/tools/String.h"
 #include "proxy/BindHost.h"
+#include "proxy/VarDiffConfig.h"
 #include "proxy/workers/Workers.h"
 
 
@@ -65,15 +66,22 @@ public:
     inline const BindHosts &bind() const           { return m_bind; }
     inline const String &accessLog() const         { return m_accessLog; }
     inline const String &password() const          { return m_password; }
+    inline const String &shareJournal() const      { return m_shareJournal; }
+    inline const String &statsFile() const         { return m_statsFile; }
+    inline const VarDiffConfig &vardiff() const    { return m_vardiff; }
     inline int mode() const                        { return m_mode; }
     inline int reuseTimeout() const                { return m_reuseTimeout; }
+    inline uint32_t spareThreshold() const         { return m_spareThreshold; }
+    inline uint32_t spareUpstreams() const         { return m_spareUpstreams; }
     inline static IConfig *create()                { return new Config(); }
     inline uint64_t diff() const                   { return m_diff; }
+    inline uint64_t workersTimeout() const         { return m_workersTimeout; }
     inline Workers::Mode workersMode() const       { return m_workersMode; }
 
 private:
     void setCustomDiff(uint64_t diff);
     void setMode(const char *mode);
+    void setSpareThreshold(uint32_t threshold);
     void setWorkersMode(const rapidjson::Value &value);
 
     BindHosts m_bind;
@@ -84,7 +92,13 @@ private:
     int m_reuseTimeout          = 0;
     String m_accessLog;
     String m_password;
+    String m_shareJournal;
+    String m_statsFile;
+    uint32_t m_spareThreshold   = 90;
+    uint32_t m_spareUpstreams   = 0;
     uint64_t m_diff             = 0;
+    uint64_t m_workersTimeout   = 86400;
+    VarDiffConfig m_vardiff;
     Workers::Mode m_workersMode = Workers::RigID;
 };
 
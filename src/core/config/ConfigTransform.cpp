@@ -26,6 +26,7 @@
 #include "core/config/ConfigTransform.h"
 #include "base/kernel/interfaces/IConfig.h"
 #include "proxy/BindHost.h"
+#include "proxy/VarDiffConfig.h"
 
 
 namespace xmrig
@@ -69,8 +70,15 @@ void xmrig::ConfigTransform::transform(rapidjson::Document &doc, int key, const
     case IConfig::ProxyPasswordKey: /* --access-password */
         return set(doc, "access-password", arg);
 
+    case IConfig::StatsFileKey: /* --stats-file */
+        return set(doc, "stats-file", arg);
+
+    case IConfig::ShareJournalKey: /* --share-journal */
+        return set(doc, "share-journal", arg);
+
     case IConfig::CustomDiffStatsKey: /* --custom-diff-stats */
     case IConfig::DebugKey:   /* --debug */
+    case IConfig::VarDiffKey: /* --vardiff */
         return transformBoolean(doc, key, true);
 
     case IConfig::WorkersKey: /* --no-workers */
@@ -82,6 +90,10 @@ void xmrig::ConfigTransform::transform(rapidjson::Document &doc, int key, const
 
     case IConfig::CustomDiffKey: /* --custom-diff */
     case IConfig::ReuseTimeoutKey: /* --reuse-timeout */
+    case IConfig::SpareUpstreamsKey: /* --spare-upstreams */
+    case IConfig::SpareThresholdKey: /* --spare-threshold */
+    case IConfig::VarDiffTargetKey: /* --vardiff-target */
+    case IConfig::WorkersTimeoutKey: /* --workers-timeout */
         return transformUint64(doc, key, static_cast<uint64_t>(strtol(arg, nullptr, 10)));
 
     case IConfig::LoginFileKey: /* --login-file */
@@ -108,6 +120,9 @@ void xmrig::ConfigTransform::transformBoolean(rapidjson::Document &doc, int key,
     case IConfig::AlgoExtKey: /* --no-algo-ext */
         return set(doc, "algo-ext", enable);
 
+    case IConfig::VarDiffKey: /* --vardiff */
+        return set(doc, VarDiffConfig::kField, VarDiffConfig::kEnabled, enable);
+
     default:
         break;
     }
@@ -123,6 +138,18 @@ void xmrig::ConfigTransform::transformUint64(rapidjson::Document &doc, int key,
     case IConfig::ReuseTimeoutKey: /* --reuse-timeout */
         return set(doc, "reuse-timeout", arg);
 
+    case IConfig::SpareUpstreamsKey: /* --spare-upstreams */
+        return set(doc, "spare-upstreams", arg);
+
+    case IConfig::SpareThresholdKey: /* --spare-threshold */
+        return set(doc, "spare-threshold", arg);
+
+    case IConfig::VarDiffTargetKey: /* --vardiff-target */
+        return set(doc, VarDiffConfig::kField, VarDiffConfig::kTargetTime, arg);
+
+    case IConfig::WorkersTimeoutKey: /* --workers-timeout */
+        return set(doc, "workers-timeout", arg);
+
     default:
         break;
     }
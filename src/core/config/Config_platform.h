@@ -66,9 +66,13 @@ static struct option const options[] = {
     { "donate-level",      1, nullptr, IConfig::DonateLevelKey    },
     { "keepalive",         2, nullptr, IConfig::KeepAliveKey      },
     { "log-file",          1, nullptr, IConfig::LogFileKey        },
+    { "log-rotate-size",   1, nullptr, IConfig::LogRotateSizeKey  },
+    { "log-rotate-interval", 1, nullptr, IConfig::LogRotateIntervalKey },
+    { "log-rotate-keep",   1, nullptr, IConfig::LogRotateKeepKey  },
     { "no-color",          0, nullptr, IConfig::ColorKey          },
     { "no-workers",        0, nullptr, IConfig::WorkersKey        },
     { "workers",           1, nullptr, IConfig::WorkersAdvKey     },
+    { "workers-timeout",   1, nullptr, IConfig::WorkersTimeoutKey },
     { "pass",              1, nullptr, IConfig::PasswordKey       },
     { "pool-coin",         1, nullptr, IConfig::PoolCoinKey       },
     { "retries",           1, nullptr, IConfig::RetriesKey        },
@@ -80,6 +84,12 @@ static struct option const options[] = {
     { "userpass",          1, nullptr, IConfig::UserpassKey       },
     { "verbose",           0, nullptr, IConfig::VerboseKey        },
     { "reuse-timeout",     1, nullptr, IConfig::ReuseTimeoutKey   },
+    { "share-journal",     1, nullptr, IConfig::ShareJournalKey   },
+    { "spare-upstreams",   1, nullptr, IConfig::SpareUpstreamsKey },
+    { "spare-threshold",   1, nullptr, IConfig::SpareThresholdKey },
+    { "stats-file",        1, nullptr, IConfig::StatsFileKey      },
+    { "vardiff",           0, nullptr, IConfig::VarDiffKey        },
+    { "vardiff-target",    1, nullptr, IConfig::VarDiffTargetKey  },
     { "mode",              1, nullptr, IConfig::ModeKey           },
     { "rig-id",            1, nullptr, IConfig::RigIdKey          },
     { "tls",               0, nullptr, IConfig::TlsKey            },
@@ -104,6 +114,9 @@ static struct option const options[] = {
     { "ipv4",              0, nullptr, IConfig::DnsIPv4Key        },
     { "ipv6",              0, nullptr, IConfig::DnsIPv6Key        },
     { "dns-ttl",           1, nullptr, IConfig::DnsTtlKey         },
+    { "dns-stale-ttl",     1, nullptr, IConfig::DnsStaleTtlKey    },
+    { "dns-negative-ttl",  1, nullptr, IConfig::DnsNegativeTtlKey },
+    { "dns-cache-file",    1, nullptr, IConfig::DnsCacheFileKey   },
     { "spend-secret-key",  1, nullptr, IConfig::SpendSecretKey    },
     { nullptr,             0, nullptr, 0 }
 };
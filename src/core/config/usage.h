@@ -59,6 +59,9 @@ static inline const std::string &usage()
     u += "  -4, --ipv4                    resolve names to IPv4 addresses\n";
     u += "  -6, --ipv6                    resolve names to IPv6 addresses\n";
     u += "      --dns-ttl=N               N seconds (default: 30) TTL for internal DNS cache\n";
+    u += "      --dns-stale-ttl=N         N seconds (default: 600) to serve expired records while refreshing\n";
+    u += "      --dns-negative-ttl=N      N seconds (default: 5) to cache failed lookups\n";
+    u += "      --dns-cache-file=FILE     keep resolved records in FILE for a fast start\n";
 
 #   ifdef XMRIG_FEATURE_HTTP2
     u += "      --dns-pool-ns             enable DNS-over-HTTPS with pool NS lookup (default: enabled)\n";
@@ -88,7 +91,12 @@ static inline const std::string &usage()
     u += "      --custom-diff=N           override pool diff\n";
     u += "      --custom-diff-stats       calculate stats using custom diff shares instead of pool shares\n";
     u += "      --reuse-timeout=N         timeout in seconds for reuse pool connections in simple mode\n";
+    u += "      --spare-upstreams=N       keep N pre-connected pool connections ready for new miners (default: 0)\n";
+    u += "      --spare-threshold=N       occupancy in percent after which an upstream no longer counts as spare (default: 90)\n";
+    u += "      --vardiff                 enable per-miner variable difficulty\n";
+    u += "      --vardiff-target=N        desired seconds between shares for vardiff (default: 15)\n";
     u += "      --no-workers              disable per worker statistics\n";
+    u += "      --workers-timeout=N       forget disconnected workers after N seconds idle, 0 = never (default: 86400)\n";
     u += "      --access-password=P       set password to restrict connections to the proxy\n";
     u += "      --no-algo-ext             disable \"algo\" protocol extension\n";
 
@@ -121,6 +129,11 @@ static inline const std::string &usage()
 
     u += "  -l, --log-file=FILE           log all output to a file\n";
     u += "  -A  --access-log-file=FILE    log all workers access to a file\n";
+    u += "      --log-rotate-size=MB      rotate log files larger than MB megabytes\n";
+    u += "      --log-rotate-interval=H   rotate log files every H hours\n";
+    u += "      --log-rotate-keep=N       keep N rotated log files (default: 7, 0 keeps all)\n";
+    u += "      --stats-file=FILE         keep global and per worker stats in FILE across restarts\n";
+    u += "      --share-journal=DIR       append every share to binary journal segments in DIR\n";
     u += "      --no-color                disable colored output\n";
     u += "      --verbose                 verbose output\n";
 
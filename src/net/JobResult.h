@@ -56,6 +56,11 @@ public:
     String jobId;
     uint64_t diff             = 0;
 
+#   ifdef XMRIG_FEATURE_PROFILING
+    uint64_t readAt           = 0;
+    uint64_t parsedAt         = 0;
+#   endif
+
 private:
     uint64_t m_actualDiff     = 0;
 };
@@ -0,0 +1,162 @@
+/* XMRig
+ * Copyright (c) 2026      HashVault   <https://github.com/HashVault>, <root@hashvault.pro>
+ *
+ *   This program is free software: you can redistribute it and/or modify
+ *   it under the terms of the GNU General Public License as published by
+ *   the Free Software Foundation, either version 3 of the License, or
+ *   (at your option) any later version.
+ *
+ *   This program is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ *   GNU General Public License for more details.
+ *
+ *   You should have received a copy of the GNU General Public License
+ *   along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#include "proxy/AsyncEvents.h"
+#include "3rdparty/rapidjson/document.h"
+#include "proxy/Events.h"
+#include "proxy/interfaces/IEventSink.h"
+
+
+#include <algorithm>
+
+
+namespace xmrig {
+
+
+// upper bound on a lost wakeup, the producer only signals when the thread is known to sleep.
+static constexpr uint64_t kIdleWaitNs = 100 * 1000 * 1000;
+
+
+} // namespace xmrig
+
+
+xmrig::AsyncEvents::AsyncEvents() :
+    m_ring(kSize)
+{
+    uv_cond_init(&m_cond);
+    uv_mutex_init(&m_mutex);
+    uv_thread_create(&m_thread, onThread, this);
+}
+
+
+xmrig::AsyncEvents::~AsyncEvents()
+{
+    uv_mutex_lock(&m_mutex);
+    m_stop = true;
+    uv_cond_signal(&m_cond);
+    uv_mutex_unlock(&m_mutex);
+
+    uv_thread_join(&m_thread);
+
+    uv_cond_destroy(&m_cond);
+    uv_mutex_destroy(&m_mutex);
+}
+
+
+rapidjson::Value xmrig::AsyncEvents::toJSON(rapidjson::Document &doc) const
+{
+    using namespace rapidjson;
+    auto &allocator = doc.GetAllocator();
+
+    Value out(kObjectType);
+    out.AddMember("depth",     depth(), allocator);
+    out.AddMember("max_depth", m_maxDepth, allocator);
+    out.AddMember("size",      static_cast<uint64_t>(kSize), allocator);
+    out.AddMember("dropped",   m_dropped, allocator);
+
+    return out;
+}
+
+
+void xmrig::AsyncEvents::subscribe(IEvent::Type type, IEventSink *sink)
+{
+    if (m_sinks[type].empty()) {
+        Events::subscribe(type, this);
+    }
+
+    m_sinks[type].push_back(sink);
+}
+
+
+void xmrig::AsyncEvents::onThread(void *arg)
+{
+    static_cast<AsyncEvents *>(arg)->run();
+}
+
+
+void xmrig::AsyncEvents::push(const IEvent *event)
+{
+    const uint64_t head = m_head.load(std::memory_order_acquire);
+    uint64_t tail       = m_tail.load(std::memory_order_relaxed);
+
+    for (IEventSink *sink : m_sinks[event->type()]) {
+        if (tail - head >= kSize) {
+            m_dropped++;
+            continue;
+        }
+
+        Slot &slot           = m_ring[tail % kSize];
+        slot.sink            = sink;
+        slot.record.type     = event->type();
+        slot.record.rejected = event->isRejected();
+
+        if (sink->capture(event, slot.record)) {
+            tail++;
+        }
+    }
+
+    if (tail == m_tail.load(std::memory_order_relaxed)) {
+        return;
+    }
+
+    m_tail.store(tail);
+    m_maxDepth = std::max(m_maxDepth, tail - head);
+
+    if (m_sleeping.load()) {
+        uv_mutex_lock(&m_mutex);
+        uv_cond_signal(&m_cond);
+        uv_mutex_unlock(&m_mutex);
+    }
+}
+
+
+void xmrig::AsyncEvents::run()
+{
+    uint64_t head = m_head.load(std::memory_order_relaxed);
+
+    while (true) {
+        const uint64_t tail = m_tail.load(std::memory_order_acquire);
+
+        if (head == tail) {
+            uv_mutex_lock(&m_mutex);
+
+            if (m_stop) {
+                uv_mutex_unlock(&m_mutex);
+                break;
+            }
+
+            m_sleeping.store(true);
+
+            if (m_tail.load() == head) {
+                uv_cond_timedwait(&m_cond, &m_mutex, kIdleWaitNs);
+            }
+
+            m_sleeping.store(false);
+            uv_mutex_unlock(&m_mutex);
+
+            continue;
+        }
+
+        for (; head < tail; ++head) {
+            const Slot &slot = m_ring[head % kSize];
+            slot.sink->process(slot.record);
+
+            m_head.store(head + 1, std::memory_order_release);
+        }
+    }
+}
@@ -0,0 +1,95 @@
+/* XMRig
+ * Copyright (c) 2026      HashVault   <https://github.com/HashVault>, <root@hashvault.pro>
+ *
+ *   This program is free software: you can redistribute it and/or modify
+ *   it under the terms of the GNU General Public License as published by
+ *   the Free Software Foundation, either version 3 of the License, or
+ *   (at your option) any later version.
+ *
+ *   This program is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ *   GNU General Public License for more details.
+ *
+ *   You should have received a copy of the GNU General Public License
+ *   along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef XMRIG_ASYNCEVENTS_H
+#define XMRIG_ASYNCEVENTS_H
+
+
+#include <atomic>
+#include <cstdint>
+#include <uv.h>
+#include <vector>
+
+
+#include "3rdparty/rapidjson/fwd.h"
+#include "base/tools/Object.h"
+#include "proxy/events/EventRecord.h"
+#include "proxy/interfaces/IEventListener.h"
+
+
+namespace xmrig {
+
+
+class IEventSink;
+
+
+/**
+ * Second event tier for listeners that only consume events (logging), each sink copies what it
+ * needs into a record on the loop and formats or writes it on a background thread. Records go
+ * through a single producer/single consumer ring, when it is full new records are dropped and counted.
+ */
+class AsyncEvents : public IEventListener
+{
+public:
+    XMRIG_DISABLE_COPY_MOVE(AsyncEvents)
+
+    constexpr static size_t kSize = 1024;
+
+    AsyncEvents();
+    ~AsyncEvents() override;
+
+    rapidjson::Value toJSON(rapidjson::Document &doc) const;
+    void subscribe(IEvent::Type type, IEventSink *sink);
+
+    inline uint64_t depth() const    { return m_tail.load(std::memory_order_relaxed) - m_head.load(std::memory_order_relaxed); }
+    inline uint64_t dropped() const  { return m_dropped; }
+    inline uint64_t maxDepth() const { return m_maxDepth; }
+
+protected:
+    inline void onEvent(IEvent *event) override         { push(event); }
+    inline void onRejectedEvent(IEvent *event) override { push(event); }
+
+private:
+    struct Slot
+    {
+        IEventSink *sink;
+        EventRecord record;
+    };
+
+    static void onThread(void *arg);
+
+    void push(const IEvent *event);
+    void run();
+
+    bool m_stop          = false;
+    std::atomic<bool> m_sleeping{false};
+    std::atomic<uint64_t> m_head{0};
+    std::atomic<uint64_t> m_tail{0};
+    std::vector<IEventSink *> m_sinks[IEvent::TypeMax];
+    std::vector<Slot> m_ring;
+    uint64_t m_dropped   = 0;
+    uint64_t m_maxDepth  = 0;
+    uv_cond_t m_cond;
+    uv_mutex_t m_mutex;
+    uv_thread_t m_thread;
+};
+
+
+} /* namespace xmrig */
+
+
+#endif /* XMRIG_ASYNCEVENTS_H */
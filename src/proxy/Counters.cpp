@@ -23,6 +23,13 @@
 
 
 #include "Counters.h"
+#include "base/io/log/Log.h"
+#include "base/io/log/Tags.h"
+#include "base/kernel/interfaces/IClient.h"
+#include "base/net/stratum/Pool.h"
+
+
+#include <cinttypes>
 
 
 uint32_t Counters::m_added     = 0;
@@ -30,5 +37,19 @@ uint32_t Counters::m_removed   = 0;
 uint64_t Counters::accepted    = 0;
 uint64_t Counters::connections = 0;
 uint64_t Counters::expired     = 0;
+xmrig::Histogram Counters::failover;
+xmrig::Histogram Counters::firstJob;
+xmrig::Histogram Counters::loopLag;
 uint64_t Counters::m_maxMiners = 0;
 uint64_t Counters::m_miners    = 0;
+
+
+void Counters::addFailover(size_t mapper, const xmrig::IClient *client, uint64_t gap, bool verbose)
+{
+    failover.add(gap);
+
+    if (verbose) {
+        LOG_INFO("%s " CYAN("%04u ") YELLOW_BOLD("failover") " to " CYAN_BOLD("%s:%d") " in " WHITE_BOLD("%" PRIu64 " ms"),
+                 xmrig::Tags::network(), static_cast<unsigned>(mapper), client->pool().host().data(), client->pool().port(), gap);
+    }
+}
@@ -28,6 +28,14 @@
 #include <stdint.h>
 
 
+#include "proxy/Histogram.h"
+
+
+namespace xmrig {
+class IClient;
+}
+
+
 class Counters
 {
 public:
@@ -57,6 +65,8 @@ public:
     }
 
 
+    static void addFailover(size_t mapper, const xmrig::IClient *client, uint64_t gap, bool verbose);
+
     static inline uint32_t added()     { return m_added; }
     static inline uint32_t removed()   { return m_removed; }
     static inline uint64_t maxMiners() { return m_maxMiners; }
@@ -65,6 +75,9 @@ public:
     static uint64_t accepted;
     static uint64_t connections;
     static uint64_t expired;
+    static xmrig::Histogram failover;
+    static xmrig::Histogram firstJob;
+    static xmrig::Histogram loopLag;
 
 private:
     static uint32_t m_added;
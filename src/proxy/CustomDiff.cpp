@@ -68,19 +68,19 @@ void xmrig::CustomDiff::login(LoginEvent *event)
 
     event->miner()->setCustomDiff(m_controller->config()->diff());
 
-    if (event->miner()->user().isNull()) {
-        return;
-    }
-
-    const char *str = strrchr(event->miner()->user(), '+');
-    if (!str) {
-        return;
+    // explicit user+diff override always wins over vardiff.
+    if (!event->miner()->user().isNull()) {
+        const char *str = strrchr(event->miner()->user(), '+');
+        if (str) {
+            const unsigned long diff = strtoul(str + 1, nullptr, 10);
+            if (diff >= 100 && diff < INT_MAX) {
+                event->miner()->setCustomDiff(diff);
+                return;
+            }
+        }
     }
 
-    const unsigned long diff = strtoul(str + 1, nullptr, 10);
-    if (diff < 100 || diff >= INT_MAX) {
-        return;
+    if (m_controller->config()->vardiff().isEnabled()) {
+        event->miner()->setVarDiff(m_controller->config()->vardiff());
     }
-
-    event->miner()->setCustomDiff(diff);
 }
@@ -46,6 +46,8 @@ public:
         RouteNotFound
     };
 
+    constexpr static int kCount = RouteNotFound + 1;
+
     static const char *toString(int code);
 };
 
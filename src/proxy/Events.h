@@ -26,8 +26,7 @@
 #define XMRIG_EVENTS_H
 
 
-#include <map>
-#include <vector>
+#include <cstddef>
 
 
 #include "interfaces/IEvent.h"
@@ -37,16 +36,42 @@
 namespace xmrig {
 
 
+/**
+ * Listeners are wired into a fixed per-type table at startup, dispatch is an indexed walk over a
+ * flat array. Events started from inside a listener (an AcceptEvent from a SubmitEvent) are built
+ * in the next slot of Event's per-thread buffer, so each loop thread has its own nesting depth.
+ */
 class Events
 {
 public:
+    constexpr static size_t kMaxListeners = 16;
+
     static bool exec(IEvent *event);
     static void stop();
     static void subscribe(IEvent::Type type, IEventListener *listener);
 
+    static inline size_t depth() { return m_depth; }
+
+#   ifdef APP_DEVEL
+    static void benchmark();
+#   endif
+
 private:
-    static bool m_ready;
-    static std::map<IEvent::Type, std::vector<IEventListener*> > m_listeners;
+    struct Table
+    {
+        IEventListener *listeners[kMaxListeners];
+        size_t size;
+    };
+
+    static inline void dispatch(const Table &table, IEvent *event)
+    {
+        for (size_t i = 0; i < table.size; ++i) {
+            event->isRejected() ? table.listeners[i]->onRejectedEvent(event) : table.listeners[i]->onEvent(event);
+        }
+    }
+
+    static Table m_table[IEvent::TypeMax];
+    static thread_local size_t m_depth;
 };
 
 
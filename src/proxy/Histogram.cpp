@@ -0,0 +1,130 @@
+/* XMRig
+ * Copyright (c) 2026      HashVault   <https://github.com/HashVault>, <root@hashvault.pro>
+ *
+ *   This program is free software: you can redistribute it and/or modify
+ *   it under the terms of the GNU General Public License as published by
+ *   the Free Software Foundation, either version 3 of the License, or
+ *   (at your option) any later version.
+ *
+ *   This program is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ *   GNU General Public License for more details.
+ *
+ *   You should have received a copy of the GNU General Public License
+ *   along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#include "proxy/Histogram.h"
+#include "3rdparty/rapidjson/document.h"
+
+
+#include <algorithm>
+
+
+uint64_t xmrig::Histogram::quantile(double q) const
+{
+    if (m_count == 0) {
+        return 0;
+    }
+
+    const auto rank = static_cast<uint64_t>(q * static_cast<double>(m_count - 1)) + 1;
+    uint64_t seen   = 0;
+
+    for (size_t i = 0; i < kBuckets; ++i) {
+        seen += m_buckets[i];
+
+        if (seen >= rank) {
+            const uint64_t lo = lowerBound(i);
+            const uint64_t hi = i + 1 < kBuckets ? lowerBound(i + 1) - 1 : lo;
+
+            return std::min(lo + (hi - lo) / 2, m_max);
+        }
+    }
+
+    return m_max;
+}
+
+
+void xmrig::Histogram::add(uint64_t value)
+{
+    value = std::min<uint64_t>(value, 0xFFFFFFFFULL);
+
+    m_buckets[index(value)]++;
+    m_count++;
+    m_sum += value;
+
+    if (value > m_max) {
+        m_max = value;
+    }
+}
+
+
+void xmrig::Histogram::reset()
+{
+    m_buckets.fill(0);
+    m_count = 0;
+    m_max   = 0;
+    m_sum   = 0;
+}
+
+
+rapidjson::Value xmrig::Histogram::toJSON(rapidjson::Document &doc) const
+{
+    using namespace rapidjson;
+    auto &allocator = doc.GetAllocator();
+
+    Value out(kObjectType);
+    out.AddMember("count", m_count, allocator);
+    out.AddMember("avg",   mean(), allocator);
+    out.AddMember("p50",   quantile(0.5), allocator);
+    out.AddMember("p90",   quantile(0.9), allocator);
+    out.AddMember("p99",   quantile(0.99), allocator);
+    out.AddMember("max",   m_max, allocator);
+
+    return out;
+}
+
+
+xmrig::Histogram &xmrig::Histogram::operator+=(const Histogram &other)
+{
+    for (size_t i = 0; i < kBuckets; ++i) {
+        m_buckets[i] += other.m_buckets[i];
+    }
+
+    m_count += other.m_count;
+    m_sum   += other.m_sum;
+    m_max    = std::max(m_max, other.m_max);
+
+    return *this;
+}
+
+
+size_t xmrig::Histogram::index(uint64_t value)
+{
+    if (value < kSub) {
+        return static_cast<size_t>(value);
+    }
+
+    size_t msb = kSubBits;
+    while ((value >> (msb + 1)) != 0) {
+        msb++;
+    }
+
+    const size_t shift = msb - kSubBits;
+
+    return ((shift + 1) << kSubBits) + static_cast<size_t>((value >> shift) & (kSub - 1));
+}
+
+
+uint64_t xmrig::Histogram::lowerBound(size_t index)
+{
+    if (index < kSub) {
+        return index;
+    }
+
+    const size_t shift = (index >> kSubBits) - 1;
+
+    return static_cast<uint64_t>(kSub + (index & (kSub - 1))) << shift;
+}
@@ -0,0 +1,73 @@
+/* XMRig
+ * Copyright (c) 2026      HashVault   <https://github.com/HashVault>, <root@hashvault.pro>
+ *
+ *   This program is free software: you can redistribute it and/or modify
+ *   it under the terms of the GNU General Public License as published by
+ *   the Free Software Foundation, either version 3 of the License, or
+ *   (at your option) any later version.
+ *
+ *   This program is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ *   GNU General Public License for more details.
+ *
+ *   You should have received a copy of the GNU General Public License
+ *   along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef XMRIG_HISTOGRAM_H
+#define XMRIG_HISTOGRAM_H
+
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+
+#include "3rdparty/rapidjson/fwd.h"
+
+
+namespace xmrig {
+
+
+/**
+ * Fixed size log-linear histogram, each power of two range is split into 16 linear sub-buckets,
+ * so any reported quantile is within ~6% of the real value. Values above 2^32-1 are clamped.
+ */
+class Histogram
+{
+public:
+    constexpr static size_t kSubBits = 4;
+    constexpr static size_t kSub     = 1 << kSubBits;
+    constexpr static size_t kBuckets = (32 - kSubBits + 1) * kSub;
+
+    Histogram() { reset(); }
+
+    uint64_t quantile(double q) const;
+    void add(uint64_t value);
+    void reset();
+
+    rapidjson::Value toJSON(rapidjson::Document &doc) const;
+
+    inline uint64_t count() const { return m_count; }
+    inline uint64_t max() const   { return m_max; }
+    inline uint64_t mean() const  { return m_count ? m_sum / m_count : 0; }
+    inline uint64_t sum() const   { return m_sum; }
+
+    Histogram &operator+=(const Histogram &other);
+
+private:
+    static size_t index(uint64_t value);
+    static uint64_t lowerBound(size_t index);
+
+    std::array<uint64_t, kBuckets> m_buckets;
+    uint64_t m_count = 0;
+    uint64_t m_max   = 0;
+    uint64_t m_sum   = 0;
+};
+
+
+} /* namespace xmrig */
+
+
+#endif /* XMRIG_HISTOGRAM_H */
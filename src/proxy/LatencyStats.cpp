@@ -0,0 +1,49 @@
+/* XMRig
+ * Copyright (c) 2026      HashVault   <https://github.com/HashVault>, <root@hashvault.pro>
+ *
+ *   This program is free software: you can redistribute it and/or modify
+ *   it under the terms of the GNU General Public License as published by
+ *   the Free Software Foundation, either version 3 of the License, or
+ *   (at your option) any later version.
+ *
+ *   This program is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ *   GNU General Public License for more details.
+ *
+ *   You should have received a copy of the GNU General Public License
+ *   along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#include "proxy/LatencyStats.h"
+#include "3rdparty/rapidjson/document.h"
+
+
+xmrig::Histogram xmrig::LatencyStats::recent() const
+{
+    Histogram out = m_previous;
+    out += m_current;
+
+    return out;
+}
+
+
+rapidjson::Value xmrig::LatencyStats::toJSON(rapidjson::Document &doc) const
+{
+    using namespace rapidjson;
+    auto &allocator = doc.GetAllocator();
+
+    Value out(kObjectType);
+    out.AddMember("total",  m_total.toJSON(doc), allocator);
+    out.AddMember("recent", recent().toJSON(doc), allocator);
+
+    return out;
+}
+
+
+void xmrig::LatencyStats::rotate()
+{
+    m_previous = m_current;
+    m_current.reset();
+}
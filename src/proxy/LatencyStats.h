@@ -0,0 +1,52 @@
+/* XMRig
+ * Copyright (c) 2026      HashVault   <https://github.com/HashVault>, <root@hashvault.pro>
+ *
+ *   This program is free software: you can redistribute it and/or modify
+ *   it under the terms of the GNU General Public License as published by
+ *   the Free Software Foundation, either version 3 of the License, or
+ *   (at your option) any later version.
+ *
+ *   This program is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ *   GNU General Public License for more details.
+ *
+ *   You should have received a copy of the GNU General Public License
+ *   along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef XMRIG_LATENCYSTATS_H
+#define XMRIG_LATENCYSTATS_H
+
+
+#include "proxy/Histogram.h"
+
+
+namespace xmrig {
+
+
+/**
+ * Share latency since start plus a recent view built from the current and the previous window,
+ * memory is fixed no matter how many shares were accepted.
+ */
+class LatencyStats
+{
+public:
+    inline const Histogram &total() const { return m_total; }
+    inline void add(uint64_t elapsed)     { m_total.add(elapsed); m_current.add(elapsed); }
+
+    Histogram recent() const;
+    rapidjson::Value toJSON(rapidjson::Document &doc) const;
+    void rotate();
+
+private:
+    Histogram m_current;
+    Histogram m_previous;
+    Histogram m_total;
+};
+
+
+} /* namespace xmrig */
+
+
+#endif /* XMRIG_LATENCYSTATS_H */
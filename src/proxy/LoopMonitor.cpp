@@ -0,0 +1,115 @@
+/* XMRig
+ * Copyright (c) 2026      HashVault   <https://github.com/HashVault>, <root@hashvault.pro>
+ *
+ *   This program is free software: you can redistribute it and/or modify
+ *   it under the terms of the GNU General Public License as published by
+ *   the Free Software Foundation, either version 3 of the License, or
+ *   (at your option) any later version.
+ *
+ *   This program is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ *   GNU General Public License for more details.
+ *
+ *   You should have received a copy of the GNU General Public License
+ *   along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#include "proxy/LoopMonitor.h"
+#include "3rdparty/rapidjson/document.h"
+#include "base/io/log/Log.h"
+#include "base/io/log/Tags.h"
+#include "base/tools/Timer.h"
+#include "proxy/Counters.h"
+
+
+#include <cinttypes>
+
+
+namespace xmrig {
+
+
+static const char *kSourceNames[LoopMonitor::SourceMax] = { "event", "api", "tick", "unknown" };
+
+
+bool LoopMonitor::m_attributed = false;
+LoopMonitor::Scope *LoopMonitor::m_current = nullptr;
+uint64_t LoopMonitor::m_lastLog = 0;
+uint64_t LoopMonitor::m_stalls[LoopMonitor::SourceMax] = {};
+
+
+} /* namespace xmrig */
+
+
+xmrig::LoopMonitor::LoopMonitor() :
+    m_timer(new Timer(this, kInterval, kInterval))
+{
+}
+
+
+xmrig::LoopMonitor::~LoopMonitor()
+{
+    delete m_timer;
+}
+
+
+const char *xmrig::LoopMonitor::name(Source source)
+{
+    return kSourceNames[source];
+}
+
+
+rapidjson::Value xmrig::LoopMonitor::toJSON(rapidjson::Document &doc)
+{
+    using namespace rapidjson;
+    auto &allocator = doc.GetAllocator();
+
+    Value stalls(kObjectType);
+    for (size_t i = 0; i < SourceMax; ++i) {
+        stalls.AddMember(StringRef(kSourceNames[i]), m_stalls[i], allocator);
+    }
+
+    Value out(kObjectType);
+    out.AddMember("lag_ms", Counters::loopLag.toJSON(doc), allocator);
+    out.AddMember("stalls", stalls, allocator);
+
+    return out;
+}
+
+
+void xmrig::LoopMonitor::onTimer(const Timer *)
+{
+    const uint64_t now = Chrono::steadyUSecs();
+
+    if (m_expected) {
+        const uint64_t lag = now > m_expected ? now - m_expected : 0;
+        Counters::loopLag.add(lag / 1000);
+
+        // nothing instrumented took long enough, blame whatever else ran (TLS, writes, DNS...)
+        if (lag >= kStall * 1000 && !m_attributed) {
+            stall(UnknownSource, nullptr, lag);
+        }
+    }
+
+    m_attributed = false;
+    m_expected   = now + kInterval * 1000;
+}
+
+
+void xmrig::LoopMonitor::stall(Source source, const char *detail, uint64_t elapsed)
+{
+    m_stalls[source]++;
+    m_attributed = true;
+
+    // at most one line per second, a stalled loop should not also flood the log
+    const uint64_t now = Chrono::steadyMSecs();
+    if (now - m_lastLog < 1000) {
+        return;
+    }
+
+    m_lastLog = now;
+
+    LOG_WARN("%s " YELLOW("event loop stalled for ") YELLOW_BOLD("%" PRIu64 " ms") YELLOW(" in %s%s%s"),
+             Tags::proxy(), elapsed / 1000, kSourceNames[source], detail ? " " : "", detail ? detail : "");
+}
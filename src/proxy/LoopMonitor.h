@@ -0,0 +1,110 @@
+/* XMRig
+ * Copyright (c) 2026      HashVault   <https://github.com/HashVault>, <root@hashvault.pro>
+ *
+ *   This program is free software: you can redistribute it and/or modify
+ *   it under the terms of the GNU General Public License as published by
+ *   the Free Software Foundation, either version 3 of the License, or
+ *   (at your option) any later version.
+ *
+ *   This program is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ *   GNU General Public License for more details.
+ *
+ *   You should have received a copy of the GNU General Public License
+ *   along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef XMRIG_LOOPMONITOR_H
+#define XMRIG_LOOPMONITOR_H
+
+
+#include "3rdparty/rapidjson/fwd.h"
+#include "base/kernel/interfaces/ITimerListener.h"
+#include "base/tools/Chrono.h"
+#include "base/tools/Object.h"
+
+
+namespace xmrig {
+
+
+class Timer;
+
+
+/**
+ * Event loop health: a short repeating timer measures how late the loop gets to it, and scopes
+ * around the heavy callbacks (events, API requests, the proxy tick) name the culprit of a stall.
+ */
+class LoopMonitor : public ITimerListener
+{
+public:
+    XMRIG_DISABLE_COPY_MOVE(LoopMonitor)
+
+    constexpr static uint64_t kInterval = 10;
+    constexpr static uint64_t kStall    = 50;
+
+    enum Source {
+        EventSource,
+        ApiSource,
+        TickSource,
+        UnknownSource,
+        SourceMax
+    };
+
+    class Scope
+    {
+    public:
+        XMRIG_DISABLE_COPY_MOVE_DEFAULT(Scope)
+
+        inline Scope(Source source, const char *detail) : m_detail(detail), m_source(source), m_parent(m_current), m_start(Chrono::steadyUSecs()) { m_current = this; }
+        inline ~Scope()
+        {
+            const uint64_t elapsed = Chrono::steadyUSecs() - m_start;
+            m_current = m_parent;
+
+            // nested scopes (an event inside the tick) report their own time, the parent only keeps the rest.
+            if (m_parent) {
+                m_parent->m_children += elapsed;
+            }
+
+            if (elapsed - m_children >= kStall * 1000) {
+                stall(m_source, m_detail, elapsed - m_children);
+            }
+        }
+
+    private:
+        const char *m_detail;
+        const Source m_source;
+        Scope *m_parent;
+        const uint64_t m_start;
+        uint64_t m_children = 0;
+    };
+
+    LoopMonitor();
+    ~LoopMonitor() override;
+
+    static const char *name(Source source);
+    static rapidjson::Value toJSON(rapidjson::Document &doc);
+
+    static inline uint64_t stalls(Source source) { return m_stalls[source]; }
+
+protected:
+    void onTimer(const Timer *timer) override;
+
+private:
+    static void stall(Source source, const char *detail, uint64_t elapsed);
+
+    static bool m_attributed;
+    static Scope *m_current;
+    static uint64_t m_lastLog;
+    static uint64_t m_stalls[SourceMax];
+
+    Timer *m_timer;
+    uint64_t m_expected = 0;
+};
+
+
+} /* namespace xmrig */
+
+
+#endif /* XMRIG_LOOPMONITOR_H */
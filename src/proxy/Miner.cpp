@@ -147,6 +147,13 @@ void xmrig::Miner::setJob(Job &job, int64_t extra_nonce)
         memcpy(job.rawBlob() + (job.nonceOffset() + 3) * 2, m_sendBuf, 2);
     }
 
+    if (m_vardiff.isEnabled() && m_diff) {
+        const uint64_t next = m_vardiff.retarget(diff(), job.diff(), Chrono::steadyMSecs());
+        if (next) {
+            m_customDiff = next;
+        }
+    }
+
     m_diff = job.diff();
     bool customDiff = false;
 
@@ -184,6 +191,16 @@ void xmrig::Miner::setJob(Job &job, int64_t extra_nonce)
 }
 
 
+void xmrig::Miner::setVarDiff(const VarDiffConfig &config)
+{
+    m_vardiff.start(config, Chrono::steadyMSecs());
+
+    if (config.startDiff()) {
+        m_customDiff = config.startDiff();
+    }
+}
+
+
 void xmrig::Miner::success(int64_t id, const char *status)
 {
     send(snprintf(m_sendBuf, sizeof(m_sendBuf), "{\"id\":%" PRId64 ",\"jsonrpc\":\"2.0\",\"error\":null,\"result\":{\"status\":\"%s\"}}\n", id, status));
@@ -205,7 +222,8 @@ bool xmrig::Miner::parseRequest(int64_t id, const char *method, const rapidjson:
     if (m_state == WaitLoginState) {
         if (strcmp(method, "login") == 0) {
             setState(WaitReadyState);
-            m_loginId = id;
+            m_loginId   = id;
+            m_loginTime = Chrono::steadyUSecs();
 
             Algorithms algorithms;
             if (params.HasMember("algo")) {
@@ -261,6 +279,15 @@ bool xmrig::Miner::parseRequest(int64_t id, const char *method, const rapidjson:
             event->setError(Error::InvalidNonce);
         }
 
+#       ifdef XMRIG_FEATURE_PROFILING
+        event->request.readAt   = m_readAt;
+        event->request.parsedAt = Chrono::steadyUSecs();
+#       endif
+
+        if (event->error() == Error::NoError) {
+            m_vardiff.add();
+        }
+
         if (event->error() == Error::NoError && m_customDiff && event->request.actualDiff() < m_diff) {
             success(id, "OK");
 
@@ -374,6 +401,10 @@ void xmrig::Miner::read(ssize_t nread, const uv_buf_t *buf)
 
     m_rx += size;
 
+#   ifdef XMRIG_FEATURE_PROFILING
+    m_readAt = Chrono::steadyUSecs();
+#   endif
+
 #   ifdef XMRIG_FEATURE_TLS
     if (isTLS()) {
         LOG_DEBUG("[%s] TLS received (%d bytes)", m_ip, nread);
@@ -526,6 +557,7 @@ void xmrig::Miner::setState(State state)
     if (state == ReadyState) {
         heartbeat();
         Counters::add();
+        Counters::firstJob.add(Chrono::steadyUSecs() - m_loginTime);
     }
 
     if (state == ClosingState && m_state == ReadyState) {
@@ -35,6 +35,7 @@
 #include "base/net/tools/Storage.h"
 #include "base/tools/Object.h"
 #include "base/tools/String.h"
+#include "proxy/VarDiff.h"
 
 
 using BIO = struct bio_st;
@@ -73,6 +74,7 @@ public:
     void forwardJob(const Job &job, const char *algo);
     void replyWithError(int64_t id, const char *message);
     void setJob(Job &job, int64_t extra_nonce = -1);
+    void setVarDiff(const VarDiffConfig &config);
     void success(int64_t id, const char *status);
 
     inline bool hasExtension(Extension ext) const noexcept        { return m_extensions.test(ext); }
@@ -92,6 +94,7 @@ public:
     inline uint64_t rx() const                                    { return m_rx; }
     inline uint64_t timestamp() const                             { return m_timestamp; }
     inline uint64_t tx() const                                    { return m_tx; }
+    inline const VarDiff &vardiff() const                         { return m_vardiff; }
     inline uint8_t fixedByte() const                              { return m_fixedByte; }
     inline void close()                                           { shutdown(true); }
     inline void setCustomDiff(uint64_t diff)                      { m_customDiff = diff; }
@@ -136,6 +139,7 @@ private:
     int32_t m_routeId       = -1;
     int64_t m_id;
     int64_t m_loginId       = 0;
+    uint64_t m_loginTime    = 0;
     LineReader m_reader;
     ssize_t m_mapperId      = -1;
     State m_state           = WaitLoginState;
@@ -152,11 +156,15 @@ private:
     uint64_t m_diff         = 0;
     uint64_t m_expire;
     uint64_t m_rx           = 0;
+#   ifdef XMRIG_FEATURE_PROFILING
+    uint64_t m_readAt       = 0;
+#   endif
     uint64_t m_timestamp;
     uint64_t m_tx           = 0;
     uint8_t m_fixedByte     = 0;
     int64_t m_extraNonce    = -1;
     uintptr_t m_key;
+    VarDiff m_vardiff;
     uv_tcp_t *m_socket;
 
     static char m_sendBuf[16384];
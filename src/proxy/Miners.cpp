@@ -52,19 +52,6 @@ xmrig::Miners::~Miners()
 }
 
 
-std::vector<xmrig::Miner*> xmrig::Miners::miners() const
-{
-    std::vector<Miner*> miners;
-    miners.reserve(m_miners.size());
-
-    for (const auto &s : m_miners) {
-       miners.push_back(s.second);
-    }
-
-    return miners;
-}
-
-
 void xmrig::Miners::onEvent(IEvent *event)
 {
     switch (event->type())
@@ -46,7 +46,7 @@ public:
     Miners();
     ~Miners() override;
 
-    std::vector<Miner*> miners() const;
+    inline const std::map<int64_t, Miner*> &miners() const { return m_miners; }
 
 protected:
     void onEvent(IEvent *event) override;
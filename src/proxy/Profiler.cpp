@@ -0,0 +1,80 @@
+/* XMRig
+ * Copyright (c) 2026      HashVault   <https://github.com/HashVault>, <root@hashvault.pro>
+ *
+ *   This program is free software: you can redistribute it and/or modify
+ *   it under the terms of the GNU General Public License as published by
+ *   the Free Software Foundation, either version 3 of the License, or
+ *   (at your option) any later version.
+ *
+ *   This program is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ *   GNU General Public License for more details.
+ *
+ *   You should have received a copy of the GNU General Public License
+ *   along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#include "proxy/Profiler.h"
+
+
+#ifdef XMRIG_FEATURE_PROFILING
+
+
+#include "3rdparty/rapidjson/document.h"
+#include "base/net/stratum/SubmitResult.h"
+#include "base/tools/Chrono.h"
+
+
+namespace xmrig {
+
+
+static const char *kStageNames[Profiler::StageMax] = { "read", "dispatch", "write", "upstream", "reply", "total" };
+
+
+Histogram Profiler::m_stages[Profiler::StageMax];
+
+
+} /* namespace xmrig */
+
+
+const char *xmrig::Profiler::name(Stage stage)
+{
+    return kStageNames[stage];
+}
+
+
+rapidjson::Value xmrig::Profiler::toJSON(rapidjson::Document &doc)
+{
+    using namespace rapidjson;
+    auto &allocator = doc.GetAllocator();
+
+    Value out(kObjectType);
+    for (size_t i = 0; i < StageMax; ++i) {
+        out.AddMember(StringRef(kStageNames[i]), m_stages[i].toJSON(doc), allocator);
+    }
+
+    return out;
+}
+
+
+void xmrig::Profiler::add(const SubmitResult &result)
+{
+    // shares accepted by the proxy itself (custom difficulty) never reach a pool
+    if (result.readAt == 0 || result.sentAt == 0 || result.receivedAt == 0) {
+        return;
+    }
+
+    const uint64_t now = Chrono::steadyUSecs();
+
+    m_stages[ReadStage].add(result.parsedAt - result.readAt);
+    m_stages[DispatchStage].add(result.submitAt - result.parsedAt);
+    m_stages[WriteStage].add(result.sentAt - result.submitAt);
+    m_stages[UpstreamStage].add(result.receivedAt - result.sentAt);
+    m_stages[ReplyStage].add(now - result.receivedAt);
+    m_stages[TotalStage].add(now - result.readAt);
+}
+
+
+#endif
@@ -0,0 +1,78 @@
+/* XMRig
+ * Copyright (c) 2026      HashVault   <https://github.com/HashVault>, <root@hashvault.pro>
+ *
+ *   This program is free software: you can redistribute it and/or modify
+ *   it under the terms of the GNU General Public License as published by
+ *   the Free Software Foundation, either version 3 of the License, or
+ *   (at your option) any later version.
+ *
+ *   This program is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ *   GNU General Public License for more details.
+ *
+ *   You should have received a copy of the GNU General Public License
+ *   along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef XMRIG_PROFILER_H
+#define XMRIG_PROFILER_H
+
+
+#ifdef XMRIG_FEATURE_PROFILING
+#   include "proxy/Histogram.h"
+#   define PROFILE_SHARE(result) xmrig::Profiler::add(result)
+#else
+#   define PROFILE_SHARE(result)
+#endif
+
+
+#include "3rdparty/rapidjson/fwd.h"
+
+
+namespace xmrig {
+
+
+class SubmitResult;
+
+
+#ifdef XMRIG_FEATURE_PROFILING
+/**
+ * Per-stage share latency in microseconds, compiled in only with -DWITH_PROFILING=ON.
+ *
+ * read      first byte of the read callback to the parsed submit request
+ * dispatch  submit event through the splitter to the pool client
+ * write     serialization and write of the submit to the pool
+ * upstream  pool round trip
+ * reply     result dispatch and write of the reply to the miner
+ * total     read to reply
+ */
+class Profiler
+{
+public:
+    enum Stage {
+        ReadStage,
+        DispatchStage,
+        WriteStage,
+        UpstreamStage,
+        ReplyStage,
+        TotalStage,
+        StageMax
+    };
+
+    static const char *name(Stage stage);
+    static rapidjson::Value toJSON(rapidjson::Document &doc);
+    static void add(const SubmitResult &result);
+
+    static inline const Histogram &stage(Stage stage) { return m_stages[stage]; }
+
+private:
+    static Histogram m_stages[StageMax];
+};
+#endif
+
+
+} /* namespace xmrig */
+
+
+#endif /* XMRIG_PROFILER_H */
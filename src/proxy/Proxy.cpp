@@ -40,10 +40,13 @@
 #include "core/Controller.h"
 #include "Counters.h"
 #include "log/AccessLog.h"
+#include "log/LogLimiter.h"
 #include "log/ShareLog.h"
+#include "proxy/AsyncEvents.h"
 #include "proxy/Events.h"
 #include "proxy/events/ConnectionEvent.h"
 #include "proxy/Login.h"
+#include "proxy/LoopMonitor.h"
 #include "proxy/Miner.h"
 #include "proxy/Miners.h"
 #include "proxy/ProxyDebug.h"
@@ -53,6 +56,8 @@
 #include "proxy/splitters/nicehash/NonceSplitter.h"
 #include "proxy/splitters/simple/SimpleSplitter.h"
 #include "proxy/Stats.h"
+#include "proxy/ShareJournal.h"
+#include "proxy/StatsSnapshot.h"
 #include "proxy/workers/Workers.h"
 
 
@@ -64,6 +69,7 @@
 
 #ifdef XMRIG_FEATURE_API
 #   include "api/v1/ApiRouter.h"
+#   include "api/v1/Metrics.h"
 #   include "base/api/Api.h"
 #endif
 
@@ -95,13 +101,27 @@ xmrig::Proxy::Proxy(Controller *controller) :
     m_stats     = new Stats(controller);
     m_shareLog  = new ShareLog(controller, m_stats);
     m_accessLog = new AccessLog(controller);
+    m_events    = new AsyncEvents();
     m_workers   = new Workers(controller);
 
+    if (!controller->config()->statsFile().isEmpty()) {
+        m_snapshot = new StatsSnapshot(controller->config()->statsFile(), m_stats, m_workers);
+    }
+
+    if (!controller->config()->shareJournal().isEmpty()) {
+        m_journal = new ShareJournal(controller->config()->shareJournal(), m_workers);
+    }
+
     m_timer = new Timer(this);
 
 #   ifdef XMRIG_FEATURE_API
     m_api = new ApiRouter(controller);
     controller->api()->addListener(m_api);
+    controller->api()->setPush(m_api);
+    controller->api()->setStream(m_api);
+
+    m_metrics = new Metrics(controller);
+    controller->api()->setMetrics(m_metrics);
 #   endif
 
     Events::subscribe(IEvent::ConnectionType, m_miners);
@@ -111,7 +131,7 @@ xmrig::Proxy::Proxy(Controller *controller) :
     Events::subscribe(IEvent::CloseType, m_donate);
     Events::subscribe(IEvent::CloseType, splitter);
     Events::subscribe(IEvent::CloseType, m_stats);
-    Events::subscribe(IEvent::CloseType, m_accessLog);
+    m_events->subscribe(IEvent::CloseType, m_accessLog);
     Events::subscribe(IEvent::CloseType, m_workers);
 
     Events::subscribe(IEvent::LoginType, m_login);
@@ -119,7 +139,7 @@ xmrig::Proxy::Proxy(Controller *controller) :
     Events::subscribe(IEvent::LoginType, &m_customDiff);
     Events::subscribe(IEvent::LoginType, splitter);
     Events::subscribe(IEvent::LoginType, m_stats);
-    Events::subscribe(IEvent::LoginType, m_accessLog);
+    m_events->subscribe(IEvent::LoginType, m_accessLog);
     Events::subscribe(IEvent::LoginType, m_workers);
 
     Events::subscribe(IEvent::SubmitType, m_donate);
@@ -127,10 +147,18 @@ xmrig::Proxy::Proxy(Controller *controller) :
     Events::subscribe(IEvent::SubmitType, m_stats);
     Events::subscribe(IEvent::SubmitType, m_workers);
 
+    if (m_journal) {
+        Events::subscribe(IEvent::SubmitType, m_journal);
+    }
+
     Events::subscribe(IEvent::AcceptType, m_stats);
-    Events::subscribe(IEvent::AcceptType, m_shareLog);
+    m_events->subscribe(IEvent::AcceptType, m_shareLog);
     Events::subscribe(IEvent::AcceptType, m_workers);
 
+    if (m_journal) {
+        Events::subscribe(IEvent::AcceptType, m_journal);
+    }
+
     m_debug = new ProxyDebug(controller->config()->isDebug());
 
     controller->addListener(this);
@@ -141,20 +169,29 @@ xmrig::Proxy::~Proxy()
 {
     Events::stop();
 
+    delete m_events;
     delete m_timer;
+    delete m_loop;
 
     for (Server *server : m_servers) {
         delete server;
     }
 
 #   ifdef XMRIG_FEATURE_API
+    m_controller->api()->setMetrics(nullptr);
+    m_controller->api()->setPush(nullptr);
+    m_controller->api()->setStream(nullptr);
+
     delete m_api;
+    delete m_metrics;
 #   endif
 
     delete m_donate;
     delete m_login;
     delete m_miners;
     delete m_splitter;
+    delete m_journal;
+    delete m_snapshot;
     delete m_stats;
     delete m_shareLog;
     delete m_accessLog;
@@ -188,10 +225,17 @@ void xmrig::Proxy::connect()
         this->bind(host);
     }
 
+    m_loop = new LoopMonitor();
     m_timer->start(1000, 1000);
 }
 
 
+void xmrig::Proxy::getPools(rapidjson::Value &reply, rapidjson::Document &doc) const
+{
+    m_splitter->getPools(reply, doc);
+}
+
+
 void xmrig::Proxy::printConnections()
 {
     m_splitter->printConnections();
@@ -217,6 +261,18 @@ void xmrig::Proxy::toggleDebug()
 }
 
 
+const xmrig::AsyncEvents &xmrig::Proxy::events() const
+{
+    return *m_events;
+}
+
+
+const xmrig::Stats &xmrig::Proxy::stats() const
+{
+    return *m_stats;
+}
+
+
 const xmrig::StatsData &xmrig::Proxy::statsData() const
 {
     return m_stats->data();
@@ -229,12 +285,24 @@ const std::vector<xmrig::Worker> &xmrig::Proxy::workers() const
 }
 
 
-std::vector<xmrig::Miner*> xmrig::Proxy::miners() const
+size_t xmrig::Proxy::liveWorkers() const
+{
+    return m_workers->live();
+}
+
+
+const std::map<int64_t, xmrig::Miner*> &xmrig::Proxy::miners() const
 {
     return m_miners->miners();
 }
 
 
+uint64_t xmrig::Proxy::evictedWorkers() const
+{
+    return m_workers->evicted();
+}
+
+
 #ifdef APP_DEVEL
 void xmrig::Proxy::printState()
 {
@@ -292,6 +360,8 @@ void xmrig::Proxy::print()
 
 void xmrig::Proxy::tick()
 {
+    LoopMonitor::Scope scope(LoopMonitor::TickSource, nullptr);
+
     m_stats->tick(m_ticks, m_splitter);
 
     m_ticks++;
@@ -307,4 +377,18 @@ void xmrig::Proxy::tick()
 
     m_splitter->tick(m_ticks);
     m_workers->tick(m_ticks);
+
+    LogLimiter::tick();
+
+    if (m_snapshot) {
+        m_snapshot->tick(m_ticks);
+    }
+
+    if (m_journal) {
+        m_journal->tick(m_ticks);
+    }
+
+#   ifdef XMRIG_FEATURE_API
+    m_controller->api()->push();
+#   endif
 }
@@ -26,9 +26,11 @@
 #define XMRIG_PROXY_H
 
 
+#include <map>
 #include <vector>
 
 
+#include "3rdparty/rapidjson/fwd.h"
 #include "base/kernel/interfaces/IBaseListener.h"
 #include "base/kernel/interfaces/ITimerListener.h"
 #include "base/tools/Object.h"
@@ -42,16 +44,21 @@ namespace xmrig {
 
 class AccessLog;
 class ApiRouter;
+class AsyncEvents;
 class BindHost;
 class Controller;
 class DonateSplitter;
 class ISplitter;
 class Login;
+class LoopMonitor;
 class Miner;
 class Miners;
+class Metrics;
 class ProxyDebug;
 class Server;
+class ShareJournal;
 class ShareLog;
+class StatsSnapshot;
 class TlsContext;
 class Workers;
 
@@ -65,14 +72,19 @@ public:
     ~Proxy() override;
 
     void connect();
+    void getPools(rapidjson::Value &reply, rapidjson::Document &doc) const;
     void printConnections();
     void printHashrate();
     void printWorkers();
     void toggleDebug();
 
+    const AsyncEvents &events() const;
+    const Stats &stats() const;
     const StatsData &statsData() const;
     const std::vector<Worker> &workers() const;
-    std::vector<Miner*> miners() const;
+    size_t liveWorkers() const;
+    const std::map<int64_t, Miner*> &miners() const;
+    uint64_t evictedWorkers() const;
 
 #   ifdef APP_DEVEL
     void printState();
@@ -93,15 +105,20 @@ private:
 
     AccessLog *m_accessLog;
     ApiRouter *m_api    = nullptr;
+    AsyncEvents *m_events;
+    Metrics *m_metrics  = nullptr;
     Controller *m_controller;
     CustomDiff m_customDiff;
     DonateSplitter *m_donate;
     ISplitter *m_splitter;
     Login *m_login;
+    LoopMonitor *m_loop = nullptr;
     Miners *m_miners;
     ProxyDebug *m_debug;
+    ShareJournal *m_journal = nullptr;
     ShareLog *m_shareLog;
     Stats *m_stats;
+    StatsSnapshot *m_snapshot = nullptr;
     std::vector<Server*> m_servers;
     Timer *m_timer      = nullptr;
     TlsContext *m_tls   = nullptr;
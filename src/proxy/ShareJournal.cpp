@@ -0,0 +1,386 @@
+/* XMRig
+ * Copyright (c) 2026      HashVault   <https://github.com/HashVault>, <root@hashvault.pro>
+ *
+ *   This program is free software: you can redistribute it and/or modify
+ *   it under the terms of the GNU General Public License as published by
+ *   the Free Software Foundation, either version 3 of the License, or
+ *   (at your option) any later version.
+ *
+ *   This program is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ *   GNU General Public License for more details.
+ *
+ *   You should have received a copy of the GNU General Public License
+ *   along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <cinttypes>
+#include <cstdio>
+#include <cstring>
+
+
+#include "proxy/ShareJournal.h"
+#include "base/io/log/Log.h"
+#include "base/io/log/Tags.h"
+#include "base/tools/Chrono.h"
+#include "proxy/events/AcceptEvent.h"
+#include "proxy/events/SubmitEvent.h"
+#include "proxy/workers/Workers.h"
+
+
+namespace xmrig {
+
+
+static const uint64_t kRetryTicks = 10;
+
+
+} // namespace xmrig
+
+
+xmrig::ShareJournal::ShareJournal(const char *dir, Workers *workers) :
+    m_dir(dir),
+    m_workers(workers)
+{
+    if (!m_dir.empty() && m_dir.back() != '/' && m_dir.back() != '\\') {
+        m_dir += '/';
+    }
+
+    uv_cond_init(&m_cond);
+    uv_mutex_init(&m_mutex);
+    uv_thread_create(&m_thread, onThread, this);
+
+    prepare();
+}
+
+
+xmrig::ShareJournal::~ShareJournal()
+{
+    if (m_header) {
+        save(true);
+    }
+
+    uv_mutex_lock(&m_mutex);
+    m_stop = true;
+    uv_cond_signal(&m_cond);
+    uv_mutex_unlock(&m_mutex);
+
+    uv_thread_join(&m_thread);
+
+    // a segment created ahead of time and never used is not left behind.
+    if (m_next) {
+        const std::string path = m_next->path().data();
+        m_next->close();
+        remove(path.c_str());
+    }
+
+    uv_cond_destroy(&m_cond);
+    uv_mutex_destroy(&m_mutex);
+}
+
+
+void xmrig::ShareJournal::tick(uint64_t ticks)
+{
+    bool failed = false;
+
+    uv_mutex_lock(&m_mutex);
+    std::swap(failed, m_failed);
+    uv_mutex_unlock(&m_mutex);
+
+    if (failed) {
+        LOG_ERR("%s " RED("failed to create share journal segment in ") RED_BOLD("\"%s\"") RED(", retrying in %" PRIu64 " s"), Tags::proxy(), m_dir.c_str(), kRetryTicks);
+
+        m_preparing = false;
+        m_retry     = ticks + kRetryTicks;
+    }
+
+    if (!m_preparing && m_retry && ticks >= m_retry) {
+        m_retry = 0;
+        prepare();
+    }
+
+    if (!m_header && !activate()) {
+        return;
+    }
+
+    if ((ticks % 60) == 0) {
+        save(false);
+        m_file->flush();
+    }
+}
+
+
+void xmrig::ShareJournal::onEvent(IEvent *event)
+{
+    if (event->type() == IEvent::AcceptType) {
+        accept(static_cast<const AcceptEvent *>(event), Accepted);
+    }
+}
+
+
+void xmrig::ShareJournal::onRejectedEvent(IEvent *event)
+{
+    switch (event->type()) {
+    case IEvent::SubmitType:
+        invalid(static_cast<const SubmitEvent *>(event));
+        break;
+
+    case IEvent::AcceptType:
+        accept(static_cast<const AcceptEvent *>(event), Rejected);
+        break;
+
+    default:
+        break;
+    }
+}
+
+
+bool xmrig::ShareJournal::create(MappedFile &file, const char *path)
+{
+    // a disk without room for the whole segment fails here, not later as SIGBUS on the loop thread.
+    if (!file.open(path, sizeof(Header) + kCapacity * sizeof(Record))) {
+        remove(path);
+
+        return false;
+    }
+
+    auto header = reinterpret_cast<Header *>(file.data());
+
+    memset(header, 0, sizeof(Header));
+    header->magic      = kMagic;
+    header->version    = kVersion;
+    header->recordSize = sizeof(Record);
+    header->capacity   = kCapacity;
+
+    return true;
+}
+
+
+void xmrig::ShareJournal::onThread(void *arg)
+{
+    static_cast<ShareJournal *>(arg)->run();
+}
+
+
+void xmrig::ShareJournal::writeIndex(const Job &job)
+{
+    // names only ever get appended within a segment, a save writes the new ones and the header.
+    FILE *fp = fopen(job.path.c_str(), job.offset ? "r+b" : "wb");
+    if (!fp) {
+        return;
+    }
+
+    Header header     = job.header;
+    header.magic      = kIndexMagic;
+    header.recordSize = sizeof(Name);
+    header.capacity   = job.offset + job.names.size();
+
+    fwrite(&header, sizeof(Header), 1, fp);
+
+    if (!job.names.empty() && fseek(fp, static_cast<long>(sizeof(Header) + job.offset * sizeof(Name)), SEEK_SET) == 0) {
+        fwrite(job.names.data(), sizeof(Name), job.names.size(), fp);
+    }
+
+    fclose(fp);
+}
+
+
+bool xmrig::ShareJournal::activate()
+{
+    std::unique_ptr<MappedFile> file;
+
+    uv_mutex_lock(&m_mutex);
+    file.swap(m_next);
+    uv_mutex_unlock(&m_mutex);
+
+    if (!file) {
+        return false;
+    }
+
+    m_file      = std::move(file);
+    m_header    = reinterpret_cast<Header *>(m_file->data());
+    m_records   = reinterpret_cast<Record *>(m_file->data() + sizeof(Header));
+    m_preparing = false;
+
+    if (m_dropped) {
+        LOG_WARN("%s " YELLOW("share journal resumed, ") YELLOW_BOLD("%" PRIu64) YELLOW(" shares were not journaled"), Tags::proxy(), m_dropped);
+
+        m_dropped = 0;
+    }
+
+    prepare();
+
+    return true;
+}
+
+
+void xmrig::ShareJournal::accept(const AcceptEvent *event, Result result)
+{
+    Record record{};
+    record.diff       = event->result.diff;
+    record.actualDiff = event->result.actualDiff;
+    record.mapper     = static_cast<uint32_t>(event->mapperId());
+    record.latency    = static_cast<uint32_t>(event->result.elapsed);
+    record.result     = result;
+    record.flags      = (event->isDonate() ? Donate : 0) | (event->isCustomDiff() ? CustomDiff : 0);
+
+    append(event->miner(), record);
+}
+
+
+void xmrig::ShareJournal::append(const Miner *miner, Record &record)
+{
+    if (!m_header && !activate()) {
+        m_dropped++;
+
+        return;
+    }
+
+    const Worker *worker = m_workers->worker(miner);
+
+    record.timestamp = Chrono::currentMSecsSinceEpoch();
+    record.worker    = worker ? worker->key() : 0;
+
+    // names are kept for the whole segment, workers evicted before the end stay resolvable.
+    if (record.worker && m_seen.insert(record.worker).second) {
+        Name name{};
+        name.worker = record.worker;
+        strncpy(name.name, worker->name(), kNameSize - 1);
+
+        m_names.push_back(name);
+    }
+
+    memcpy(m_records + m_header->count, &record, sizeof(Record));
+
+    if (m_header->count == 0) {
+        m_header->first = record.timestamp;
+    }
+
+    // the count is bumped after the record, a reader never sees a half written share.
+    m_header->last = record.timestamp;
+    m_header->count++;
+
+    if (m_header->count == m_header->capacity) {
+        rotate();
+    }
+}
+
+
+void xmrig::ShareJournal::invalid(const SubmitEvent *event)
+{
+    const Miner *miner = event->miner();
+
+    Record record{};
+    record.diff       = miner ? miner->diff() : 0;
+    record.actualDiff = event->request.actualDiff();
+    record.mapper     = miner ? static_cast<uint32_t>(miner->mapperId()) : UINT32_MAX;
+    record.result     = Invalid;
+    record.error      = static_cast<uint8_t>(event->error());
+    record.flags      = event->expired ? Expired : 0;
+
+    append(miner, record);
+}
+
+
+void xmrig::ShareJournal::prepare()
+{
+    if (m_preparing) {
+        return;
+    }
+
+    Job job;
+    job.prepare = true;
+    job.path    = m_dir + "shares-" + std::to_string(Chrono::currentMSecsSinceEpoch()) + ".bin";
+
+    m_preparing = true;
+    push(std::move(job));
+}
+
+
+void xmrig::ShareJournal::push(Job &&job)
+{
+    uv_mutex_lock(&m_mutex);
+    m_jobs.emplace_back(std::move(job));
+    uv_cond_signal(&m_cond);
+    uv_mutex_unlock(&m_mutex);
+}
+
+
+void xmrig::ShareJournal::rotate()
+{
+    save(true);
+
+    if (!activate()) {
+        LOG_WARN("%s " YELLOW("next share journal segment is not ready, shares are dropped until it is"), Tags::proxy());
+    }
+}
+
+
+void xmrig::ShareJournal::run()
+{
+    while (true) {
+        uv_mutex_lock(&m_mutex);
+
+        while (m_jobs.empty() && !m_stop) {
+            uv_cond_wait(&m_cond, &m_mutex);
+        }
+
+        if (m_jobs.empty()) {
+            uv_mutex_unlock(&m_mutex);
+            break;
+        }
+
+        Job job = std::move(m_jobs.front());
+        m_jobs.pop_front();
+        uv_mutex_unlock(&m_mutex);
+
+        if (job.prepare) {
+            std::unique_ptr<MappedFile> file(new MappedFile());
+            const bool ok = create(*file, job.path.c_str());
+
+            uv_mutex_lock(&m_mutex);
+
+            if (ok) {
+                m_next = std::move(file);
+            }
+            else {
+                m_failed = true;
+            }
+
+            uv_mutex_unlock(&m_mutex);
+
+            continue;
+        }
+
+        writeIndex(job);
+
+        if (job.file) {
+            job.file->flush();
+            job.file->close();
+        }
+    }
+}
+
+
+void xmrig::ShareJournal::save(bool close)
+{
+    Job job;
+    job.header = *m_header;
+    job.path   = m_file->path().data();
+    job.offset = m_indexed;
+    job.path.replace(job.path.size() - 4, 4, ".idx");
+    job.names.swap(m_names);
+
+    m_indexed += job.names.size();
+
+    if (close) {
+        job.file = std::move(m_file);
+
+        m_header  = nullptr;
+        m_records = nullptr;
+        m_indexed = 0;
+        m_seen.clear();
+    }
+
+    push(std::move(job));
+}
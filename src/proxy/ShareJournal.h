@@ -0,0 +1,171 @@
+/* XMRig
+ * Copyright (c) 2026      HashVault   <https://github.com/HashVault>, <root@hashvault.pro>
+ *
+ *   This program is free software: you can redistribute it and/or modify
+ *   it under the terms of the GNU General Public License as published by
+ *   the Free Software Foundation, either version 3 of the License, or
+ *   (at your option) any later version.
+ *
+ *   This program is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ *   GNU General Public License for more details.
+ *
+ *   You should have received a copy of the GNU General Public License
+ *   along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef XMRIG_SHAREJOURNAL_H
+#define XMRIG_SHAREJOURNAL_H
+
+
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <string>
+#include <unordered_set>
+#include <uv.h>
+#include <vector>
+
+
+#include "base/io/MappedFile.h"
+#include "proxy/interfaces/IEventListener.h"
+
+
+namespace xmrig {
+
+
+class AcceptEvent;
+class Miner;
+class SubmitEvent;
+class Workers;
+
+
+/**
+ * Append-only binary journal of every share, one fixed size record per share in memory mapped
+ * segment files named shares-<unix ms>.bin, so journaling a share costs a memcpy and a counter
+ * store. Worker names live in a sidecar shares-<unix ms>.idx extended once a minute, records
+ * only carry Worker::hash() of the name. File work runs on a writer thread, which also creates
+ * the next segment ahead of time, so rotation only swaps pointers. Segments are read offline
+ * with vltrig-journal.
+ */
+class ShareJournal : public IEventListener
+{
+public:
+    XMRIG_DISABLE_COPY_MOVE_DEFAULT(ShareJournal)
+
+    constexpr static uint64_t kMagic      = 0x314C4E524A544C56ULL; // "VLTJRNL1"
+    constexpr static uint64_t kIndexMagic = 0x3158444E494A4C56ULL; // "VLJINDX1"
+    constexpr static uint32_t kVersion    = 2;
+    constexpr static size_t kCapacity     = 1 << 20;
+    constexpr static size_t kNameSize     = 120;
+
+    enum Result : uint8_t {
+        Accepted,
+        Rejected,
+        Invalid
+    };
+
+    enum Flags : uint16_t {
+        Donate     = 1,
+        CustomDiff = 2,
+        Expired    = 4
+    };
+
+    struct Header
+    {
+        uint64_t magic;
+        uint32_t version;
+        uint32_t recordSize;
+        uint64_t capacity;
+        uint64_t count;
+        uint64_t first;
+        uint64_t last;
+        uint64_t reserved[2];
+    };
+
+    struct Record
+    {
+        uint64_t timestamp;
+        uint64_t diff;
+        uint64_t actualDiff;
+        uint64_t worker;
+        uint32_t mapper;
+        uint32_t latency;
+        uint8_t result;
+        uint8_t error;
+        uint16_t flags;
+        uint32_t reserved;
+    };
+
+    struct Name
+    {
+        uint64_t worker;
+        char name[kNameSize];
+    };
+
+    ShareJournal(const char *dir, Workers *workers);
+    ~ShareJournal() override;
+
+    void tick(uint64_t ticks);
+
+protected:
+    void onEvent(IEvent *event) override;
+    void onRejectedEvent(IEvent *event) override;
+
+private:
+    struct Job
+    {
+        bool prepare        = false;
+        Header header{};
+        std::string path;
+        std::unique_ptr<MappedFile> file;
+        std::vector<Name> names;
+        uint64_t offset     = 0;
+    };
+
+    static bool create(MappedFile &file, const char *path);
+    static void onThread(void *arg);
+    static void writeIndex(const Job &job);
+
+    bool activate();
+    void accept(const AcceptEvent *event, Result result);
+    void append(const Miner *miner, Record &record);
+    void invalid(const SubmitEvent *event);
+    void prepare();
+    void push(Job &&job);
+    void rotate();
+    void run();
+    void save(bool close);
+
+    bool m_failed       = false;
+    bool m_preparing    = false;
+    bool m_stop         = false;
+    Header *m_header    = nullptr;
+    Record *m_records   = nullptr;
+    std::deque<Job> m_jobs;
+    std::string m_dir;
+    std::unique_ptr<MappedFile> m_file;
+    std::unique_ptr<MappedFile> m_next;
+    std::unordered_set<uint64_t> m_seen;
+    std::vector<Name> m_names;
+    uint64_t m_dropped  = 0;
+    uint64_t m_indexed  = 0;
+    uint64_t m_retry    = 0;
+    uv_cond_t m_cond;
+    uv_mutex_t m_mutex;
+    uv_thread_t m_thread;
+    Workers *m_workers;
+};
+
+
+static_assert(sizeof(ShareJournal::Header) == 64, "journal header layout");
+static_assert(sizeof(ShareJournal::Record) == 48, "journal record layout");
+static_assert(sizeof(ShareJournal::Name) == 128, "journal index layout");
+
+
+} /* namespace xmrig */
+
+
+#endif /* XMRIG_SHAREJOURNAL_H */
@@ -23,12 +23,16 @@
  */
 
 
+#include <algorithm>
+
+
 #include "base/net/stratum/SubmitResult.h"
 #include "core/config/Config.h"
 #include "core/Controller.h"
 #include "Counters.h"
 #include "interfaces/ISplitter.h"
 #include "proxy/events/AcceptEvent.h"
+#include "proxy/events/SubmitEvent.h"
 #include "proxy/Stats.h"
 
 
@@ -48,6 +52,27 @@ void xmrig::Stats::tick(uint64_t ticks, const ISplitter *splitter)
 {
     ticks++;
 
+    const uint64_t minute = TimeSeries::minute();
+    if (minute != m_minute) {
+        if (m_minute) {
+            m_series.close(m_minute);
+
+            for (auto &kv : m_upstreamSeries) {
+                kv.second.close(m_minute);
+            }
+        }
+
+        m_minute = minute;
+    }
+
+    if ((ticks % kLatencyWindow) == 0) {
+        m_data.latency.rotate();
+
+        for (auto &kv : m_data.upstreamLatency) {
+            kv.second.rotate();
+        }
+    }
+
     if ((ticks % m_hashrate.tickTime()) == 0) {
         m_hashrate.tick();
 
@@ -96,6 +121,7 @@ void xmrig::Stats::onRejectedEvent(IEvent *event)
     {
     case IEvent::SubmitType:
         m_data.invalid++;
+        m_data.errors[static_cast<size_t>(static_cast<SubmitEvent*>(event)->error())]++;
         break;
 
     case IEvent::AcceptType:
@@ -114,7 +140,10 @@ void xmrig::Stats::accept(const AcceptEvent *event)
         return;
     }
 
-    m_hashrate.add(m_controller->config()->isCustomDiffStats() ? event->statsDiff() : event->result.diff);
+    const uint64_t diff = m_controller->config()->isCustomDiffStats() ? event->statsDiff() : event->result.diff;
+
+    m_hashrate.add(diff);
+    m_series.add(diff);
 
     if (event->isCustomDiff()) {
         return;
@@ -135,7 +164,12 @@ void xmrig::Stats::accept(const AcceptEvent *event)
         std::sort(m_data.topDiff.rbegin(), m_data.topDiff.rend());
     }
 
-    m_data.latency.push_back(event->result.elapsed > 0xFFFF ? 0xFFFF : (uint16_t) event->result.elapsed);
+    m_data.latency.add(event->result.elapsed);
+
+    if (!event->isDonate() && event->upstream()) {
+        m_data.upstreamLatency[event->upstream()].add(event->result.elapsed);
+        m_upstreamSeries[event->upstream()].add(event->result.diff);
+    }
 }
 
 
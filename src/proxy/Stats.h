@@ -26,12 +26,15 @@
 #define XMRIG_STATS_H
 
 
+#include <map>
 #include <stdint.h>
+#include <string>
 
 
 #include "interfaces/IEventListener.h"
 #include "proxy/StatsData.h"
 #include "proxy/TickingCounter.h"
+#include "proxy/TimeSeries.h"
 
 
 namespace xmrig {
@@ -44,14 +47,20 @@ class ISplitter;
 
 class Stats : public IEventListener
 {
+    friend class StatsSnapshot;
+
 public:
+    constexpr static uint64_t kLatencyWindow = 600;
+
     Stats(Controller *controller);
     ~Stats() override;
 
     void tick(uint64_t ticks, const ISplitter *splitter);
 
-    inline const StatsData &data() const      { return m_data; }
-    inline double hashrate(int seconds) const { return m_hashrate.calc(seconds); }
+    inline const StatsData &data() const                                   { return m_data; }
+    inline const TimeSeries &series() const                                { return m_series; }
+    inline const std::map<std::string, TimeSeries> &upstreamSeries() const { return m_upstreamSeries; }
+    inline double hashrate(int seconds) const                              { return m_hashrate.calc(seconds); }
 
 protected:
     void onEvent(IEvent *event) override;
@@ -63,7 +72,10 @@ private:
 
     Controller *m_controller;
     StatsData m_data;
+    std::map<std::string, TimeSeries> m_upstreamSeries;
     TickingCounter<uint32_t> m_hashrate;
+    TimeSeries m_series;
+    uint64_t m_minute = 0;
 };
 
 
@@ -26,12 +26,14 @@
 #define XMRIG_STATSDATA_H
 
 
-#include <algorithm>
 #include <array>
-#include <vector>
+#include <map>
+#include <string>
 
 
 #include "base/tools/Chrono.h"
+#include "proxy/Error.h"
+#include "proxy/LatencyStats.h"
 #include "proxy/interfaces/ISplitter.h"
 
 
@@ -46,26 +48,15 @@ public:
 
     inline uint32_t avgTime() const
     {
-        if (latency.empty()) {
+        if (latency.total().count() == 0) {
             return 0;
         }
 
-        return static_cast<uint32_t>(uptime() / latency.size());
+        return static_cast<uint32_t>(uptime() / latency.total().count());
     }
 
 
-    inline uint32_t avgLatency() const
-    {
-        const size_t calls = latency.size();
-        if (calls == 0) {
-            return 0;
-        }
-
-        auto v = latency;
-        std::nth_element(v.begin(), v.begin() + calls / 2, v.end());
-
-        return v[calls / 2];
-    }
+    inline uint32_t avgLatency() const { return static_cast<uint32_t>(latency.total().quantile(0.5)); }
 
 
     inline double ratio() const    { return upstreams.ratio(miners); }
@@ -93,7 +84,9 @@ public:
 
     double hashrate[6] { 0.0 };
     std::array<uint64_t, 10> topDiff { { } };
-    std::vector<uint16_t> latency;
+    std::array<uint64_t, Error::kCount> errors { { } };
+    LatencyStats latency;
+    std::map<std::string, LatencyStats> upstreamLatency;
     uint64_t accepted       = 0;
     uint64_t connections    = 0;
     uint64_t donateHashes   = 0;
@@ -0,0 +1,306 @@
+/* XMRig
+ * Copyright (c) 2026      HashVault   <https://github.com/HashVault>, <root@hashvault.pro>
+ *
+ *   This program is free software: you can redistribute it and/or modify
+ *   it under the terms of the GNU General Public License as published by
+ *   the Free Software Foundation, either version 3 of the License, or
+ *   (at your option) any later version.
+ *
+ *   This program is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ *   GNU General Public License for more details.
+ *
+ *   You should have received a copy of the GNU General Public License
+ *   along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#include <algorithm>
+#include <cinttypes>
+#include <cstddef>
+#include <cstring>
+#include <vector>
+
+
+#include "proxy/StatsSnapshot.h"
+#include "base/io/log/Log.h"
+#include "base/io/log/Tags.h"
+#include "base/tools/Chrono.h"
+#include "proxy/Stats.h"
+#include "proxy/workers/Workers.h"
+
+
+namespace xmrig {
+
+
+static const uint64_t kMagic = 0x3154415453544C56ULL; // "VLTSTAT1"
+
+
+} // namespace xmrig
+
+
+xmrig::StatsSnapshot::StatsSnapshot(const char *path, Stats *stats, Workers *workers) :
+    m_stats(stats),
+    m_workers(workers)
+{
+    if (!m_file.open(path, sizeof(Header) + sizeof(Global) + words() * sizeof(uint64_t))) {
+        LOG_ERR("%s " RED("failed to map stats file ") RED_BOLD("\"%s\""), Tags::proxy(), path);
+
+        return;
+    }
+
+    load();
+}
+
+
+xmrig::StatsSnapshot::~StatsSnapshot()
+{
+    if (m_file.isOpen()) {
+        save();
+        m_file.flush();
+    }
+}
+
+
+void xmrig::StatsSnapshot::tick(uint64_t ticks)
+{
+    if (!m_file.isOpen() || (ticks % m_stats->m_hashrate.tickTime()) != 0) {
+        return;
+    }
+
+    save();
+
+    if ((ticks % 60) == 0) {
+        m_file.flush();
+    }
+}
+
+
+uint64_t xmrig::StatsSnapshot::checksum(const uint8_t *data, size_t size)
+{
+    // FNV-1a over 64-bit words, the tail is padded with zeroes.
+    uint64_t hash = 0xCBF29CE484222325ULL;
+
+    for (size_t i = 0; i < size; i += sizeof(uint64_t)) {
+        uint64_t word = 0;
+        memcpy(&word, data + i, std::min(sizeof(uint64_t), size - i));
+
+        hash = (hash ^ word) * 0x100000001B3ULL;
+    }
+
+    return hash;
+}
+
+
+uint64_t xmrig::StatsSnapshot::signature(const Worker &worker)
+{
+    // changes whenever anything stored in the record does, the hashrate ring of an idle worker is rebuilt by advance().
+    const uint64_t values[] = { worker.key(), worker.accepted(), worker.hashes(), worker.invalid(), worker.rejected(), worker.connections(), worker.lastSeen() };
+    uint64_t hash           = 0xCBF29CE484222325ULL;
+
+    for (const uint64_t value : values) {
+        hash = (hash ^ value) * 0x100000001B3ULL;
+    }
+
+    return hash;
+}
+
+
+size_t xmrig::StatsSnapshot::recordSize() const
+{
+    return sizeof(Record) + words() * sizeof(uint64_t);
+}
+
+
+size_t xmrig::StatsSnapshot::words() const
+{
+    return m_stats->m_hashrate.words();
+}
+
+
+uint64_t xmrig::StatsSnapshot::ticksSince(uint64_t time) const
+{
+    const uint64_t now = Chrono::currentMSecsSinceEpoch();
+
+    return now > time ? (now - time) / 1000 / m_stats->m_hashrate.tickTime() : 0;
+}
+
+
+void xmrig::StatsSnapshot::load()
+{
+    if (m_file.size() < sizeof(Header) + sizeof(Global)) {
+        return;
+    }
+
+    Header header{};
+    memcpy(&header, m_file.data(), sizeof(Header));
+
+    if (header.magic != kMagic) {
+        return;
+    }
+
+    const size_t global = sizeof(Global) + words() * sizeof(uint64_t);
+
+    if (header.version != kVersion || header.words != words() || header.size != global + header.workers * recordSize() || sizeof(Header) + header.size > m_file.size() ||
+        header.checksum != checksum(m_file.data() + sizeof(Header), global)) {
+        LOG_WARN("%s " YELLOW("stats file ") YELLOW_BOLD("\"%s\"") YELLOW(" is incompatible or damaged, starting from zero"), Tags::proxy(), m_file.path().data());
+
+        return;
+    }
+
+    const uint8_t *ptr = m_file.data() + sizeof(Header);
+
+    Global stored{};
+    memcpy(&stored, ptr, sizeof(Global));
+    ptr += sizeof(Global);
+
+    StatsData &data   = m_stats->m_data;
+    data.accepted     = stored.accepted;
+    data.rejected     = stored.rejected;
+    data.invalid      = stored.invalid;
+    data.expired      = stored.expired;
+    data.hashes       = stored.hashes;
+    data.donateHashes = stored.donateHashes;
+    data.maxMiners    = stored.maxMiners;
+    std::copy(stored.topDiff, stored.topDiff + data.topDiff.size(), data.topDiff.begin());
+
+    std::vector<uint64_t> state(words());
+    memcpy(state.data(), ptr, state.size() * sizeof(uint64_t));
+    ptr += state.size() * sizeof(uint64_t);
+    m_stats->m_hashrate.load(state.data());
+    m_stats->m_hashrate.advance(ticksSince(header.savedAt));
+
+    // worker names depend on the grouping mode, records made under another mode are meaningless.
+    if (header.mode != static_cast<uint32_t>(m_workers->mode()) || m_workers->mode() == Workers::None) {
+        header.workers = 0;
+    }
+
+    std::vector<uint8_t> buf(recordSize());
+    uint32_t damaged = 0;
+
+    for (uint32_t i = 0; i < header.workers; ++i, ptr += recordSize()) {
+        Record record{};
+        memcpy(buf.data(), ptr, buf.size());
+        memcpy(&record, buf.data(), sizeof(Record));
+        memcpy(state.data(), buf.data() + sizeof(Record), state.size() * sizeof(uint64_t));
+        memset(buf.data() + offsetof(Record, checksum), 0, sizeof(uint64_t));
+
+        if (record.checksum != checksum(buf.data(), buf.size())) {
+            damaged++;
+            continue;
+        }
+
+        record.name[kNameSize - 1] = '\0';
+        record.ip[kIpSize - 1]     = '\0';
+
+        // a name that filled the whole field may be truncated and would not match the live worker.
+        if (strlen(record.name) >= kNameSize - 1 || m_workers->m_map.find(record.name) != FlatIndex<std::string>::npos) {
+            continue;
+        }
+
+        const size_t id = m_workers->m_workers.size();
+        Worker worker(id, record.name, record.ip);
+        worker.m_connections = 0;
+        worker.m_accepted    = record.accepted;
+        worker.m_hashes      = record.hashes;
+        worker.m_invalid     = record.invalid;
+        worker.m_lastHash    = record.lastHash;
+        worker.m_lastSeen    = record.lastSeen ? record.lastSeen : header.savedAt;
+        worker.m_rejected    = record.rejected;
+        worker.m_hashrate.load(state.data());
+        worker.m_hashrate.advance(ticksSince(record.savedAt));
+
+        m_workers->m_map.insert(record.name, id);
+        m_workers->m_workers.push_back(std::move(worker));
+    }
+
+    if (damaged) {
+        LOG_WARN("%s " YELLOW_BOLD("%u") YELLOW(" damaged worker records in stats file ") YELLOW_BOLD("\"%s\"") YELLOW(" were skipped"), Tags::proxy(), damaged, m_file.path().data());
+    }
+
+    LOG_INFO("%s " GREEN("restored stats from ") GREEN_BOLD("\"%s\"") GREEN(", %u workers, saved %" PRIu64 "s ago"),
+             Tags::proxy(), m_file.path().data(), header.workers - damaged, (Chrono::currentMSecsSinceEpoch() - header.savedAt) / 1000);
+}
+
+
+void xmrig::StatsSnapshot::save()
+{
+    const auto &workers = m_workers->workers();
+    const size_t global = sizeof(Global) + words() * sizeof(uint64_t);
+    const size_t body   = global + workers.size() * recordSize();
+    const uint64_t now  = Chrono::currentMSecsSinceEpoch();
+
+    if (sizeof(Header) + body > m_file.size() && !m_file.resize((sizeof(Header) + body) * 3 / 2)) {
+        LOG_ERR("%s " RED("failed to grow stats file ") RED_BOLD("\"%s\""), Tags::proxy(), m_file.path().data());
+        m_file.close();
+
+        return;
+    }
+
+    uint8_t *ptr = m_file.data() + sizeof(Header);
+    const StatsData &data = m_stats->m_data;
+
+    Global stored{};
+    stored.accepted     = data.accepted;
+    stored.rejected     = data.rejected;
+    stored.invalid      = data.invalid;
+    stored.expired      = data.expired;
+    stored.hashes       = data.hashes;
+    stored.donateHashes = data.donateHashes;
+    stored.maxMiners    = data.maxMiners;
+    std::copy(data.topDiff.begin(), data.topDiff.end(), stored.topDiff);
+
+    memcpy(ptr, &stored, sizeof(Global));
+    ptr += sizeof(Global);
+
+    std::vector<uint64_t> state(words());
+    m_stats->m_hashrate.save(state.data());
+    memcpy(ptr, state.data(), state.size() * sizeof(uint64_t));
+    ptr += state.size() * sizeof(uint64_t);
+
+    // eviction compacts the workers, shifted records no longer match their slot and are rewritten too.
+    m_saved.resize(workers.size(), 0);
+
+    for (size_t i = 0; i < workers.size(); ++i, ptr += recordSize()) {
+        const Worker &worker = workers[i];
+        const uint64_t sig   = signature(worker);
+
+        if (m_saved[i] == sig) {
+            continue;
+        }
+
+        Record record{};
+        strncpy(record.name, worker.name(), kNameSize - 1);
+        strncpy(record.ip, worker.ip(), kIpSize - 1);
+        record.accepted = worker.accepted();
+        record.hashes   = worker.hashes();
+        record.invalid  = worker.invalid();
+        record.lastHash = worker.lastHash();
+        record.lastSeen = worker.connections() > 0 ? 0 : worker.lastSeen();
+        record.rejected = worker.rejected();
+        record.savedAt  = now;
+
+        worker.m_hashrate.save(state.data());
+
+        memcpy(ptr, &record, sizeof(Record));
+        memcpy(ptr + sizeof(Record), state.data(), state.size() * sizeof(uint64_t));
+
+        record.checksum = checksum(ptr, recordSize());
+        memcpy(ptr + offsetof(Record, checksum), &record.checksum, sizeof(uint64_t));
+
+        m_saved[i] = sig;
+    }
+
+    Header header{};
+    header.magic    = kMagic;
+    header.version  = kVersion;
+    header.mode     = static_cast<uint32_t>(m_workers->mode());
+    header.words    = static_cast<uint32_t>(words());
+    header.workers  = static_cast<uint32_t>(workers.size());
+    header.savedAt  = now;
+    header.size     = body;
+    header.checksum = checksum(m_file.data() + sizeof(Header), global);
+
+    memcpy(m_file.data(), &header, sizeof(Header));
+}
@@ -0,0 +1,120 @@
+/* XMRig
+ * Copyright (c) 2026      HashVault   <https://github.com/HashVault>, <root@hashvault.pro>
+ *
+ *   This program is free software: you can redistribute it and/or modify
+ *   it under the terms of the GNU General Public License as published by
+ *   the Free Software Foundation, either version 3 of the License, or
+ *   (at your option) any later version.
+ *
+ *   This program is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ *   GNU General Public License for more details.
+ *
+ *   You should have received a copy of the GNU General Public License
+ *   along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef XMRIG_STATSSNAPSHOT_H
+#define XMRIG_STATSSNAPSHOT_H
+
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+
+#include "base/io/MappedFile.h"
+
+
+namespace xmrig {
+
+
+class Stats;
+class Worker;
+class Workers;
+
+
+/**
+ * Global and per worker counters with their hashrate rings, kept in a memory mapped file.
+ *
+ * Layout: fixed header, global record, then one fixed size record per worker. Every hashrate
+ * tick the global record is copied in place, worker records only when the worker changed since
+ * its last save. Each part carries its own checksum, so a torn write after a crash is detected
+ * on the next start and only the damaged part is ignored. Restored hashrate rings are moved
+ * forward by the time they spent on disk, a restart does not shift old hashes into recent windows.
+ */
+class StatsSnapshot
+{
+public:
+    XMRIG_DISABLE_COPY_MOVE_DEFAULT(StatsSnapshot)
+
+    constexpr static uint32_t kVersion  = 2;
+    constexpr static size_t kNameSize   = 120;
+    constexpr static size_t kIpSize     = 64;
+
+    StatsSnapshot(const char *path, Stats *stats, Workers *workers);
+    ~StatsSnapshot();
+
+    void tick(uint64_t ticks);
+
+private:
+    struct Header
+    {
+        uint64_t magic;
+        uint32_t version;
+        uint32_t mode;
+        uint32_t words;
+        uint32_t workers;
+        uint64_t savedAt;
+        uint64_t size;
+        uint64_t checksum;
+        uint64_t reserved[2];
+    };
+
+    struct Global
+    {
+        uint64_t accepted;
+        uint64_t rejected;
+        uint64_t invalid;
+        uint64_t expired;
+        uint64_t hashes;
+        uint64_t donateHashes;
+        uint64_t maxMiners;
+        uint64_t topDiff[10];
+    };
+
+    struct Record
+    {
+        char name[kNameSize];
+        char ip[kIpSize];
+        uint64_t accepted;
+        uint64_t hashes;
+        uint64_t invalid;
+        uint64_t lastHash;
+        uint64_t lastSeen;          // 0 while connected, the worker was then seen until Header::savedAt
+        uint64_t rejected;
+        uint64_t savedAt;
+        uint64_t checksum;
+    };
+
+    static uint64_t checksum(const uint8_t *data, size_t size);
+    static uint64_t signature(const Worker &worker);
+
+    size_t recordSize() const;
+    size_t words() const;
+    uint64_t ticksSince(uint64_t time) const;
+    void load();
+    void save();
+
+    MappedFile m_file;
+    std::vector<uint64_t> m_saved;
+    Stats *m_stats;
+    Workers *m_workers;
+};
+
+
+} /* namespace xmrig */
+
+
+#endif /* XMRIG_STATSSNAPSHOT_H */
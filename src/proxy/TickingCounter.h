@@ -26,43 +26,177 @@
 #define XMRIG_TICKINGCOUNTER_H
 
 
+#include <algorithm>
 #include <cstdint>
 #include <cstdio>
 #include <vector>
 
 
+/**
+ * Running totals sampled at tick, minute and hour boundaries in three small rings,
+ * memory is fixed and any window is answered in O(1) as a difference of two totals.
+ *
+ * Windows up to one minute are exact, longer windows are aligned to the nearest
+ * minute (up to one hour) or hour (up to one day) boundary, and anything covering
+ * the whole history uses the grand total.
+ */
 template <class T> class TickingCounter
 {
 public:
-    inline TickingCounter(size_t tickTime) : m_tickTime(tickTime) {}
+    constexpr static size_t kMinutes = 60;
+    constexpr static size_t kHours   = 24;
+
+    inline TickingCounter(size_t tickTime) :
+        m_tickTime(tickTime),
+        m_minute(std::max<size_t>(60 / tickTime, 1)),
+        m_hour(std::max<size_t>(3600 / tickTime, 1)),
+        m_ticks(m_minute + 1, 0),
+        m_minutes(kMinutes + 1, 0),
+        m_hours(kHours + 1, 0)
+    {}
 
 
     inline double calc(size_t seconds) const
     {
-        const size_t ticks = seconds / m_tickTime;
-        const size_t size  = m_data.size();
+        const uint64_t ticks = seconds / m_tickTime;
+        if (ticks == 0 || m_total == 0) {
+            return 0.0;
+        }
 
-        uint64_t count = 0;
-        for (size_t i = size < ticks ? 0 : (size - ticks); i < size; ++i) {
-            count += m_data[i];
+        // not enough history yet, average over the full requested window.
+        if (ticks >= m_count) {
+            return (double) m_total / (ticks * m_tickTime * 1000);
+        }
+
+        const uint64_t from  = m_count - ticks;
+        uint64_t boundary    = from;
+        uint64_t count       = 0;
+
+        if (ticks < m_ticks.size()) {
+            count = m_total - m_ticks[from % m_ticks.size()];
+        }
+        else if (ticks <= m_minute * kMinutes) {
+            boundary = nearest(from, m_minute, m_minutes.size());
+            count    = m_total - m_minutes[(boundary / m_minute) % m_minutes.size()];
+        }
+        else {
+            boundary = nearest(from, m_hour, m_hours.size());
+            count    = m_total - m_hours[(boundary / m_hour) % m_hours.size()];
         }
 
         if (count == 0) {
             return 0.0;
         }
 
-        return (double) count / (ticks * m_tickTime * 1000);
+        return (double) count / ((m_count - boundary) * m_tickTime * 1000);
+    }
+
+
+    inline void tick()
+    {
+        m_total += m_pending;
+        m_pending = 0;
+        m_count++;
+
+        m_ticks[m_count % m_ticks.size()] = m_total;
+
+        if (m_count % m_minute == 0) {
+            m_minutes[(m_count / m_minute) % m_minutes.size()] = m_total;
+        }
+
+        if (m_count % m_hour == 0) {
+            m_hours[(m_count / m_hour) % m_hours.size()] = m_total;
+        }
+    }
+
+
+    // moves the counter over ticks in which nothing was counted, e.g. the time a restored snapshot spent on disk.
+    inline void advance(uint64_t ticks)
+    {
+        if (ticks == 0) {
+            return;
+        }
+
+        m_total  += m_pending;
+        m_pending = 0;
+
+        fill(m_ticks, 1, ticks);
+        fill(m_minutes, m_minute, ticks);
+        fill(m_hours, m_hour, ticks);
+
+        m_count += ticks;
+    }
+
+
+    // raw state as a flat array of words, used by the stats snapshot.
+    inline size_t words() const { return 3 + m_ticks.size() + m_minutes.size() + m_hours.size(); }
+
+
+    inline void save(uint64_t *out) const
+    {
+        *out++ = m_count;
+        *out++ = m_total;
+        *out++ = m_pending;
+
+        out = std::copy(m_ticks.begin(), m_ticks.end(), out);
+        out = std::copy(m_minutes.begin(), m_minutes.end(), out);
+        std::copy(m_hours.begin(), m_hours.end(), out);
+    }
+
+
+    inline void load(const uint64_t *in)
+    {
+        m_count   = *in++;
+        m_total   = *in++;
+        m_pending = static_cast<T>(*in++);
+
+        std::copy(in, in + m_ticks.size(), m_ticks.begin());
+        in += m_ticks.size();
+        std::copy(in, in + m_minutes.size(), m_minutes.begin());
+        in += m_minutes.size();
+        std::copy(in, in + m_hours.size(), m_hours.begin());
     }
 
 
     inline size_t tickTime() const { return m_tickTime; }
     inline void add(T count)       { m_pending += count; }
-    inline void tick()             { m_data.push_back(m_pending); m_pending = 0; }
 
 private:
+    // every boundary of the ring passed over by advance() holds the unchanged total, older ones are overwritten.
+    inline void fill(std::vector<uint64_t> &ring, uint64_t step, uint64_t ticks)
+    {
+        const uint64_t last = (m_count + ticks) / step;
+        uint64_t first      = m_count / step + 1;
+
+        if (last >= ring.size()) {
+            first = std::max(first, last - ring.size() + 1);
+        }
+
+        for (uint64_t i = first; i <= last; ++i) {
+            ring[i % ring.size()] = m_total;
+        }
+    }
+
+
+    // closest boundary to tick that is still held by a ring of the given size and is not in the future.
+    inline uint64_t nearest(uint64_t tick, uint64_t step, size_t size) const
+    {
+        const uint64_t last  = m_count / step;
+        const uint64_t first = last >= size ? last - size + 1 : 0;
+        const uint64_t index = std::min(std::max((tick + step / 2) / step, first), last);
+
+        return index * step;
+    }
+
     size_t m_tickTime;
-    std::vector<T> m_data;
+    size_t m_minute;
+    size_t m_hour;
+    std::vector<uint64_t> m_ticks;
+    std::vector<uint64_t> m_minutes;
+    std::vector<uint64_t> m_hours;
     T m_pending             = 0;
+    uint64_t m_count        = 0;
+    uint64_t m_total        = 0;
 };
 
 
@@ -0,0 +1,134 @@
+/* XMRig
+ * Copyright (c) 2026      HashVault   <https://github.com/HashVault>, <root@hashvault.pro>
+ *
+ *   This program is free software: you can redistribute it and/or modify
+ *   it under the terms of the GNU General Public License as published by
+ *   the Free Software Foundation, either version 3 of the License, or
+ *   (at your option) any later version.
+ *
+ *   This program is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ *   GNU General Public License for more details.
+ *
+ *   You should have received a copy of the GNU General Public License
+ *   along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#include "proxy/TimeSeries.h"
+#include "base/tools/Chrono.h"
+
+
+#include <algorithm>
+#include <cstring>
+
+
+namespace xmrig {
+
+
+static const char *kNames[]    = { "1m", "15m", "1h" };
+static const size_t kSizes[]   = { 120, 96, 168 };
+static const size_t kOffset[]  = { 0, 120, 120 + 96 };
+static const uint64_t kSteps[]  = { 60, 900, 3600 };
+
+
+} // namespace xmrig
+
+
+const char *xmrig::TimeSeries::name(Resolution resolution)
+{
+    return kNames[resolution];
+}
+
+
+xmrig::TimeSeries::Resolution xmrig::TimeSeries::parse(const char *name)
+{
+    if (name == nullptr) {
+        return Minute;
+    }
+
+    for (size_t i = 0; i < ResolutionMax; ++i) {
+        if (strcmp(name, kNames[i]) == 0) {
+            return static_cast<Resolution>(i);
+        }
+    }
+
+    return ResolutionMax;
+}
+
+
+size_t xmrig::TimeSeries::size(Resolution resolution)
+{
+    return kSizes[resolution];
+}
+
+
+uint64_t xmrig::TimeSeries::minute()
+{
+    return Chrono::currentMSecsSinceEpoch() / 60000;
+}
+
+
+uint64_t xmrig::TimeSeries::step(Resolution resolution)
+{
+    return kSteps[resolution];
+}
+
+
+float xmrig::TimeSeries::value(Resolution resolution, uint64_t bucket) const
+{
+    const uint64_t next = m_next[resolution];
+    const size_t size   = kSizes[resolution];
+
+    if (bucket >= next || bucket + size < next) {
+        return 0.0F;
+    }
+
+    return m_values[kOffset[resolution] + bucket % size];
+}
+
+
+void xmrig::TimeSeries::close(uint64_t minute)
+{
+    for (size_t i = 0; i < ResolutionMax; ++i) {
+        const auto resolution = static_cast<Resolution>(i);
+        const uint64_t bucket = minute * 60 / kSteps[i];
+
+        // the closing minute of this bucket was missed (clock jump or a stalled loop).
+        if (m_open[i] != bucket) {
+            if (m_sums[i]) {
+                put(resolution, m_open[i], m_sums[i]);
+            }
+
+            m_open[i] = bucket;
+            m_sums[i] = 0;
+        }
+
+        m_sums[i] += m_pending;
+
+        if (((minute + 1) * 60) % kSteps[i] == 0) {
+            put(resolution, bucket, m_sums[i]);
+            m_sums[i] = 0;
+        }
+    }
+
+    m_pending = 0;
+}
+
+
+void xmrig::TimeSeries::put(Resolution resolution, uint64_t bucket, uint64_t hashes)
+{
+    const size_t size = kSizes[resolution];
+    float *ring       = m_values.data() + kOffset[resolution];
+    uint64_t &next    = m_next[resolution];
+
+    if (next && bucket > next) {
+        for (uint64_t i = std::max(next, bucket >= size ? bucket - size + 1 : 0); i < bucket; ++i) {
+            ring[i % size] = 0.0F;
+        }
+    }
+
+    ring[bucket % size] = static_cast<float>(static_cast<double>(hashes) / kSteps[resolution]);
+    next                = std::max(next, bucket + 1);
+}
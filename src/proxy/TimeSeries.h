@@ -0,0 +1,74 @@
+/* XMRig
+ * Copyright (c) 2026      HashVault   <https://github.com/HashVault>, <root@hashvault.pro>
+ *
+ *   This program is free software: you can redistribute it and/or modify
+ *   it under the terms of the GNU General Public License as published by
+ *   the Free Software Foundation, either version 3 of the License, or
+ *   (at your option) any later version.
+ *
+ *   This program is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ *   GNU General Public License for more details.
+ *
+ *   You should have received a copy of the GNU General Public License
+ *   along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef XMRIG_TIMESERIES_H
+#define XMRIG_TIMESERIES_H
+
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+
+namespace xmrig {
+
+
+/**
+ * Hashrate history for charts, accepted difficulty is summed per wall clock minute and
+ * downsampled into fixed rings of 1 minute (2 hours), 15 minute (1 day) and 1 hour (1 week)
+ * buckets, about 1.6 KB per series. Buckets are numbered from the unix epoch, so every
+ * series closed on the same minute shares one time axis.
+ */
+class TimeSeries
+{
+public:
+    enum Resolution {
+        Minute,
+        Quarter,
+        Hour,
+        ResolutionMax
+    };
+
+    static const char *name(Resolution resolution);
+    static Resolution parse(const char *name);
+    static size_t size(Resolution resolution);
+    static uint64_t minute();
+    static uint64_t step(Resolution resolution);
+
+    float value(Resolution resolution, uint64_t bucket) const;
+    void close(uint64_t minute);
+
+    inline uint64_t next(Resolution resolution) const { return m_next[resolution]; }
+    inline void add(uint64_t diff)                    { m_pending += diff; }
+
+private:
+    constexpr static size_t kValues = 120 + 96 + 168;
+
+    void put(Resolution resolution, uint64_t bucket, uint64_t hashes);
+
+    std::array<float, kValues> m_values{};
+    uint64_t m_next[ResolutionMax] = {};
+    uint64_t m_open[ResolutionMax] = {};
+    uint64_t m_sums[ResolutionMax] = {};
+    uint64_t m_pending             = 0;
+};
+
+
+} /* namespace xmrig */
+
+
+#endif /* XMRIG_TIMESERIES_H */
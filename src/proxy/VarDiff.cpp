@@ -0,0 +1,95 @@
+/* XMRig
+ * Copyright (c) 2026      HashVault   <https://github.com/HashVault>, <root@hashvault.pro>
+ *
+ *   This program is free software: you can redistribute it and/or modify
+ *   it under the terms of the GNU General Public License as published by
+ *   the Free Software Foundation, either version 3 of the License, or
+ *   (at your option) any later version.
+ *
+ *   This program is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ *   GNU General Public License for more details.
+ *
+ *   You should have received a copy of the GNU General Public License
+ *   along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#include "proxy/VarDiff.h"
+
+
+#include <algorithm>
+
+
+double xmrig::VarDiff::shareRate(uint64_t now) const
+{
+    if (!m_enabled) {
+        return 0.0;
+    }
+
+    const uint64_t elapsed = now - m_windowStart;
+
+    // fall back to the previous window until the current one is long enough to be meaningful.
+    if (elapsed < m_config.targetTime() && m_rate > 0.0) {
+        return m_rate;
+    }
+
+    return elapsed ? m_shares * 60000.0 / elapsed : 0.0;
+}
+
+
+uint64_t xmrig::VarDiff::retarget(uint64_t current, uint64_t poolDiff, uint64_t now)
+{
+    if (!m_enabled || !current) {
+        return 0;
+    }
+
+    const uint64_t elapsed = now - m_windowStart;
+
+    // flooding miners are retargeted early, without waiting for the full window.
+    const uint64_t burst = std::max<uint64_t>(m_config.retargetTime() / m_config.targetTime(), 1) * kMaxFactor;
+    if (elapsed < m_config.retargetTime() && m_shares < burst) {
+        return 0;
+    }
+
+    const double target = m_config.targetTime();
+    const double avg    = m_shares ? static_cast<double>(elapsed) / m_shares : static_cast<double>(elapsed);
+
+    m_rate        = elapsed ? m_shares * 60000.0 / elapsed : 0.0;
+    m_shares      = 0;
+    m_windowStart = now;
+
+    const double variance = target * m_config.variance() / 100.0;
+    if (avg >= target - variance && avg <= target + variance) {
+        return 0;
+    }
+
+    const double factor = std::min(std::max(target / avg, 1.0 / kMaxFactor), static_cast<double>(kMaxFactor));
+    uint64_t diff       = static_cast<uint64_t>(current * factor);
+
+    diff = std::max(diff, m_config.minDiff());
+    if (m_config.maxDiff()) {
+        diff = std::min(diff, m_config.maxDiff());
+    }
+
+    diff = std::min(diff, poolDiff);
+    if (diff == current) {
+        return 0;
+    }
+
+    m_retargets++;
+
+    return diff;
+}
+
+
+void xmrig::VarDiff::start(const VarDiffConfig &config, uint64_t now)
+{
+    m_config      = config;
+    m_enabled     = config.isEnabled();
+    m_rate        = 0.0;
+    m_retargets   = 0;
+    m_shares      = 0;
+    m_windowStart = now;
+}
@@ -0,0 +1,63 @@
+/* XMRig
+ * Copyright (c) 2026      HashVault   <https://github.com/HashVault>, <root@hashvault.pro>
+ *
+ *   This program is free software: you can redistribute it and/or modify
+ *   it under the terms of the GNU General Public License as published by
+ *   the Free Software Foundation, either version 3 of the License, or
+ *   (at your option) any later version.
+ *
+ *   This program is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ *   GNU General Public License for more details.
+ *
+ *   You should have received a copy of the GNU General Public License
+ *   along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef XMRIG_VARDIFF_H
+#define XMRIG_VARDIFF_H
+
+
+#include <cstdint>
+
+
+#include "proxy/VarDiffConfig.h"
+
+
+namespace xmrig {
+
+
+/**
+ * Per-miner share rate tracker, counts accepted shares and on each job send decides whether the miner
+ * difficulty should move so the average share time stays within target-time +/- variance.
+ */
+class VarDiff
+{
+public:
+    VarDiff() = default;
+
+    double shareRate(uint64_t now) const;
+    uint64_t retarget(uint64_t current, uint64_t poolDiff, uint64_t now);
+    void start(const VarDiffConfig &config, uint64_t now);
+
+    inline bool isEnabled() const       { return m_enabled; }
+    inline uint32_t retargets() const   { return m_retargets; }
+    inline void add()                   { m_shares++; }
+
+private:
+    constexpr static uint32_t kMaxFactor = 4;
+
+    bool m_enabled          = false;
+    double m_rate           = 0.0;
+    uint32_t m_retargets    = 0;
+    uint32_t m_shares       = 0;
+    uint64_t m_windowStart  = 0;
+    VarDiffConfig m_config;
+};
+
+
+} /* namespace xmrig */
+
+
+#endif /* XMRIG_VARDIFF_H */
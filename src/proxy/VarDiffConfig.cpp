@@ -0,0 +1,84 @@
+/* XMRig
+ * Copyright (c) 2026      HashVault   <https://github.com/HashVault>, <root@hashvault.pro>
+ *
+ *   This program is free software: you can redistribute it and/or modify
+ *   it under the terms of the GNU General Public License as published by
+ *   the Free Software Foundation, either version 3 of the License, or
+ *   (at your option) any later version.
+ *
+ *   This program is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ *   GNU General Public License for more details.
+ *
+ *   You should have received a copy of the GNU General Public License
+ *   along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#include "proxy/VarDiffConfig.h"
+#include "3rdparty/rapidjson/document.h"
+#include "base/io/json/Json.h"
+
+
+#include <algorithm>
+#include <climits>
+
+
+namespace xmrig {
+
+
+const char *VarDiffConfig::kField           = "vardiff";
+const char *VarDiffConfig::kEnabled         = "enabled";
+const char *VarDiffConfig::kTargetTime      = "target-time";
+const char *VarDiffConfig::kRetargetTime    = "retarget-time";
+const char *VarDiffConfig::kVariance        = "variance";
+const char *VarDiffConfig::kMinDiff         = "min-diff";
+const char *VarDiffConfig::kMaxDiff         = "max-diff";
+const char *VarDiffConfig::kStartDiff       = "start-diff";
+
+
+} // namespace xmrig
+
+
+xmrig::VarDiffConfig::VarDiffConfig(const rapidjson::Value &value)
+{
+    if (!value.IsObject()) {
+        return;
+    }
+
+    m_enabled       = Json::getBool(value, kEnabled, m_enabled);
+    m_targetTime    = std::max(Json::getUint(value, kTargetTime, m_targetTime), 1U);
+    m_retargetTime  = std::max(Json::getUint(value, kRetargetTime, m_retargetTime), 1U);
+    m_variance      = std::min(Json::getUint(value, kVariance, m_variance), 100U);
+    m_minDiff       = std::max<uint64_t>(Json::getUint64(value, kMinDiff, m_minDiff), 100);
+    m_maxDiff       = Json::getUint64(value, kMaxDiff, m_maxDiff);
+    m_startDiff     = Json::getUint64(value, kStartDiff, m_startDiff);
+
+    if (m_maxDiff && m_maxDiff < m_minDiff) {
+        m_maxDiff = m_minDiff;
+    }
+
+    if (m_startDiff && (m_startDiff < 100 || m_startDiff >= INT_MAX)) {
+        m_startDiff = 0;
+    }
+}
+
+
+rapidjson::Value xmrig::VarDiffConfig::toJSON(rapidjson::Document &doc) const
+{
+    using namespace rapidjson;
+
+    auto &allocator = doc.GetAllocator();
+    Value obj(kObjectType);
+
+    obj.AddMember(StringRef(kEnabled),      m_enabled, allocator);
+    obj.AddMember(StringRef(kTargetTime),   m_targetTime, allocator);
+    obj.AddMember(StringRef(kRetargetTime), m_retargetTime, allocator);
+    obj.AddMember(StringRef(kVariance),     m_variance, allocator);
+    obj.AddMember(StringRef(kMinDiff),      m_minDiff, allocator);
+    obj.AddMember(StringRef(kMaxDiff),      m_maxDiff, allocator);
+    obj.AddMember(StringRef(kStartDiff),    m_startDiff, allocator);
+
+    return obj;
+}
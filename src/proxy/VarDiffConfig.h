@@ -0,0 +1,72 @@
+/* XMRig
+ * Copyright (c) 2026      HashVault   <https://github.com/HashVault>, <root@hashvault.pro>
+ *
+ *   This program is free software: you can redistribute it and/or modify
+ *   it under the terms of the GNU General Public License as published by
+ *   the Free Software Foundation, either version 3 of the License, or
+ *   (at your option) any later version.
+ *
+ *   This program is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ *   GNU General Public License for more details.
+ *
+ *   You should have received a copy of the GNU General Public License
+ *   along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef XMRIG_VARDIFFCONFIG_H
+#define XMRIG_VARDIFFCONFIG_H
+
+
+#include <cstdint>
+
+
+#include "3rdparty/rapidjson/fwd.h"
+
+
+namespace xmrig {
+
+
+class VarDiffConfig
+{
+public:
+    static const char *kField;
+    static const char *kEnabled;
+    static const char *kTargetTime;
+    static const char *kRetargetTime;
+    static const char *kVariance;
+    static const char *kMinDiff;
+    static const char *kMaxDiff;
+    static const char *kStartDiff;
+
+    VarDiffConfig() = default;
+    VarDiffConfig(const rapidjson::Value &value);
+
+    inline bool isEnabled() const           { return m_enabled; }
+    inline uint32_t retargetTime() const    { return m_retargetTime * 1000U; }
+    inline uint32_t targetTime() const      { return m_targetTime * 1000U; }
+    inline uint32_t variance() const        { return m_variance; }
+    inline uint64_t maxDiff() const         { return m_maxDiff; }
+    inline uint64_t minDiff() const         { return m_minDiff; }
+    inline uint64_t startDiff() const       { return m_startDiff; }
+
+    inline void setEnabled(bool enabled)    { m_enabled = enabled; }
+
+    rapidjson::Value toJSON(rapidjson::Document &doc) const;
+
+private:
+    bool m_enabled              = false;
+    uint32_t m_retargetTime     = 90U;      // seconds between retargets
+    uint32_t m_targetTime       = 15U;      // desired seconds per share
+    uint32_t m_variance         = 30U;      // allowed deviation from target time, percent
+    uint64_t m_maxDiff          = 0;        // 0 means capped only by the pool diff
+    uint64_t m_minDiff          = 1000;
+    uint64_t m_startDiff        = 0;        // 0 means start from the pool diff
+};
+
+
+} /* namespace xmrig */
+
+
+#endif /* XMRIG_VARDIFFCONFIG_H */
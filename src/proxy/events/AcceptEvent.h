@@ -38,9 +38,9 @@ namespace xmrig {
 class AcceptEvent : public MinerEvent
 {
 public:
-    static inline bool start(size_t mapperId, Miner *miner, const SubmitResult &result, bool donate, bool customDiff, const char *error = nullptr)
+    static inline bool start(size_t mapperId, Miner *miner, const SubmitResult &result, bool donate, bool customDiff, const char *error = nullptr, const char *upstream = nullptr)
     {
-        return exec(new (m_buf) AcceptEvent(mapperId, miner, result, donate, customDiff, error));
+        return exec(new (buf()) AcceptEvent(mapperId, miner, result, donate, customDiff, error, upstream));
     }
 
 
@@ -51,17 +51,19 @@ public:
     inline bool isDonate() const            { return m_donate; }
     inline bool isRejected() const override { return m_error != nullptr; }
     inline const char *error() const        { return m_error; }
+    inline const char *upstream() const     { return m_upstream; }
     inline size_t mapperId() const          { return m_mapperId; }
     inline uint64_t statsDiff() const       { return (miner() && miner()->customDiff() ? std::min(miner()->customDiff(), result.diff) : result.diff); }
 
 
 protected:
-    inline AcceptEvent(size_t mapperId, Miner *miner, const SubmitResult &result, bool donate, bool customDiff, const char *error)
+    inline AcceptEvent(size_t mapperId, Miner *miner, const SubmitResult &result, bool donate, bool customDiff, const char *error, const char *upstream)
         : MinerEvent(AcceptType, miner),
           result(result),
           m_customDiff(customDiff),
           m_donate(donate),
           m_error(error),
+          m_upstream(upstream),
           m_mapperId(mapperId)
     {}
 
@@ -70,6 +72,7 @@ private:
     bool m_customDiff;
     bool m_donate;
     const char *m_error;
+    const char *m_upstream;
     size_t m_mapperId;
 };
 
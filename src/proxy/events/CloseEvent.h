@@ -37,7 +37,7 @@ class CloseEvent : public MinerEvent
 public:
     static inline bool start(Miner *miner)
     {
-        return exec(new (m_buf) CloseEvent(miner));
+        return exec(new (buf()) CloseEvent(miner));
     }
 
 
@@ -37,7 +37,7 @@ class ConnectionEvent : public MinerEvent
 public:
     static inline bool start(Miner *miner, int port)
     {
-        return exec(new (m_buf) ConnectionEvent(miner, port));
+        return exec(new (buf()) ConnectionEvent(miner, port));
     }
 
     inline int port() const { return m_port; }
@@ -27,7 +27,7 @@
 #include "proxy/events/Event.h"
 
 
-char xmrig::Event::m_buf[4096];
+alignas(16) thread_local char xmrig::Event::m_buf[kMaxDepth + 1][kSize];
 
 
 bool xmrig::Event::exec(IEvent *event)
@@ -26,6 +26,10 @@
 #define XMRIG_EVENT_H
 
 
+#include <cstddef>
+
+
+#include "proxy/Events.h"
 #include "proxy/interfaces/IEvent.h"
 
 
@@ -35,10 +39,16 @@ namespace xmrig {
 class Event : public IEvent
 {
 public:
+    constexpr static size_t kMaxDepth = 4;
+    constexpr static size_t kSize     = 4096;
+
     inline Event(Type type) : m_type(type) {}
 
     static bool exec(IEvent *event);
 
+    // storage for the next event, one slot per nesting level plus a spare for the one Events refuses.
+    static inline void *buf() { return m_buf[Events::depth()]; }
+
     inline bool isRejected() const override { return m_rejected; }
     inline Type type() const override       { return m_type; }
     inline void reject() override           { m_rejected = true; }
@@ -49,7 +59,7 @@ protected:
     bool m_rejected = false;
     const Type m_type;
 
-    static char m_buf[4096];
+    alignas(16) static thread_local char m_buf[kMaxDepth + 1][kSize];
 };
 
 
@@ -0,0 +1,74 @@
+/* XMRig
+ * Copyright (c) 2026      HashVault   <https://github.com/HashVault>, <root@hashvault.pro>
+ *
+ *   This program is free software: you can redistribute it and/or modify
+ *   it under the terms of the GNU General Public License as published by
+ *   the Free Software Foundation, either version 3 of the License, or
+ *   (at your option) any later version.
+ *
+ *   This program is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ *   GNU General Public License for more details.
+ *
+ *   You should have received a copy of the GNU General Public License
+ *   along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef XMRIG_EVENTRECORD_H
+#define XMRIG_EVENTRECORD_H
+
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+
+#include "proxy/interfaces/IEvent.h"
+
+
+namespace xmrig {
+
+
+/**
+ * Fixed size copy of an event handed over to the sink thread, the event itself and the
+ * miner it points to are gone by the time the record is processed. Strings are truncated.
+ */
+struct EventRecord
+{
+    template<size_t N>
+    static inline void set(char (&dst)[N], const char *src)
+    {
+        if (!src) {
+            dst[0] = '\0';
+            return;
+        }
+
+        strncpy(dst, src, N - 1);
+        dst[N - 1] = '\0';
+    }
+
+    IEvent::Type type;
+    bool rejected;
+    int64_t id;
+    uint32_t mapperId;
+    uint64_t accepted;
+    uint64_t count;
+    uint64_t diff;
+    uint64_t elapsed;
+    uint64_t invalid;
+    uint64_t rejects;
+    uint64_t rx;
+    uint64_t time;
+    uint64_t tx;
+    char ip[64];
+    char user[128];
+    char agent[128];
+    char text[128];
+};
+
+
+} /* namespace xmrig */
+
+
+#endif /* XMRIG_EVENTRECORD_H */
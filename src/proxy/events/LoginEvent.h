@@ -43,7 +43,7 @@ class LoginEvent : public MinerEvent
 public:
     static inline LoginEvent *create(Miner *miner, int64_t id, const Algorithms &algorithms, const rapidjson::Value &params)
     {
-        return new (m_buf) LoginEvent(miner, id, algorithms, params);
+        return new (buf()) LoginEvent(miner, id, algorithms, params);
     }
 
 
@@ -40,7 +40,8 @@ public:
         CloseType,
         LoginType,
         SubmitType,
-        AcceptType
+        AcceptType,
+        TypeMax
     };
 
     virtual ~IEvent() = default;
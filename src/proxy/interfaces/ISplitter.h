@@ -29,6 +29,9 @@
 #include <cstdint>
 
 
+#include "3rdparty/rapidjson/fwd.h"
+
+
 namespace xmrig {
 
 
@@ -75,6 +78,7 @@ public:
     virtual Upstreams upstreams() const      = 0;
     virtual void connect()                   = 0;
     virtual void gc()                        = 0;
+    virtual void getPools(rapidjson::Value &reply, rapidjson::Document &doc) const = 0;
     virtual void printConnections()          = 0;
     virtual void tick(uint64_t ticks)        = 0;
 
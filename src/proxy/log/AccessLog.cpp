@@ -29,6 +29,7 @@
 #include "core/Controller.h"
 #include "proxy/Counters.h"
 #include "proxy/events/CloseEvent.h"
+#include "proxy/events/EventRecord.h"
 #include "proxy/events/LoginEvent.h"
 #include "proxy/Miner.h"
 
@@ -52,44 +53,58 @@ xmrig::AccessLog::AccessLog(Controller *controller)
 xmrig::AccessLog::~AccessLog() = default;
 
 
-void xmrig::AccessLog::onEvent(IEvent *event)
+bool xmrig::AccessLog::capture(const IEvent *event, EventRecord &record)
 {
     if (!m_writer.isOpen()) {
-        return;
+        return false;
     }
 
     switch (event->type())
     {
     case IEvent::LoginType:
         {
-            auto e = static_cast<LoginEvent*>(event);
-            write("#%" PRId64 " login: %s, \"%s\", flow: \"%s\", ua: \"%s\", count: %" PRIu64,
-                  e->miner()->id(), e->miner()->ip(), e->miner()->user().data(), e->flow.data(), e->miner()->agent().data(), Counters::miners());
+            auto e = static_cast<const LoginEvent*>(event);
+
+            EventRecord::set(record.text, e->flow.data());
+            EventRecord::set(record.agent, e->miner()->agent().data());
         }
         break;
 
     case IEvent::CloseType:
-        {
-            auto e = static_cast<CloseEvent*>(event);
-            if (e->miner()->mapperId() == -1) {
-                break;
-            }
-
-            const double time = static_cast<double>(Chrono::currentMSecsSinceEpoch() - e->miner()->timestamp()) / 1000.0;
-
-            write("#%" PRId64 " close: %s, \"%s\", time: %03.1fs, rx/tx: %" PRIu64 "/%" PRIu64 ", count: %" PRIu64,
-                  e->miner()->id(), e->miner()->ip(), e->miner()->user().data(), time, e->miner()->rx(), e->miner()->tx(), Counters::miners());
+        if (static_cast<const CloseEvent*>(event)->miner()->mapperId() == -1) {
+            return false;
         }
         break;
 
     default:
-        break;
+        return false;
     }
+
+    const Miner *miner = static_cast<const MinerEvent*>(event)->miner();
+
+    record.id    = miner->id();
+    record.count = Counters::miners();
+    record.time  = Chrono::currentMSecsSinceEpoch() - miner->timestamp();
+    record.rx    = miner->rx();
+    record.tx    = miner->tx();
+
+    EventRecord::set(record.ip, miner->ip());
+    EventRecord::set(record.user, miner->user().data());
+
+    return true;
 }
 
 
-void xmrig::AccessLog::onRejectedEvent(IEvent *)
+void xmrig::AccessLog::process(const EventRecord &record)
 {
+    if (record.type == IEvent::LoginType) {
+        write("#%" PRId64 " login: %s, \"%s\", flow: \"%s\", ua: \"%s\", count: %" PRIu64,
+              record.id, record.ip, record.user, record.text, record.agent, record.count);
+    }
+    else {
+        write("#%" PRId64 " close: %s, \"%s\", time: %03.1fs, rx/tx: %" PRIu64 "/%" PRIu64 ", count: %" PRIu64,
+              record.id, record.ip, record.user, static_cast<double>(record.time) / 1000.0, record.rx, record.tx, record.count);
+    }
 }
 
 
@@ -28,7 +28,7 @@
 
 #include "base/io/log/FileLogWriter.h"
 #include "base/tools/Object.h"
-#include "proxy/interfaces/IEventListener.h"
+#include "proxy/interfaces/IEventSink.h"
 
 
 namespace xmrig {
@@ -37,7 +37,7 @@ namespace xmrig {
 class Controller;
 
 
-class AccessLog : public IEventListener
+class AccessLog : public IEventSink
 {
 public:
     XMRIG_DISABLE_COPY_MOVE_DEFAULT(AccessLog)
@@ -46,8 +46,8 @@ public:
     ~AccessLog() override;
 
 protected:
-    void onEvent(IEvent *event) override;
-    void onRejectedEvent(IEvent *event) override;
+    bool capture(const IEvent *event, EventRecord &record) override;
+    void process(const EventRecord &record) override;
 
 private:
     void write(const char *fmt, ...);
@@ -0,0 +1,145 @@
+/* XMRig
+ * Copyright (c) 2026      HashVault   <https://github.com/HashVault>, <root@hashvault.pro>
+ *
+ *   This program is free software: you can redistribute it and/or modify
+ *   it under the terms of the GNU General Public License as published by
+ *   the Free Software Foundation, either version 3 of the License, or
+ *   (at your option) any later version.
+ *
+ *   This program is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ *   GNU General Public License for more details.
+ *
+ *   You should have received a copy of the GNU General Public License
+ *   along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#include <algorithm>
+#include <cinttypes>
+
+
+#include "proxy/log/LogLimiter.h"
+#include "3rdparty/rapidjson/document.h"
+#include "base/io/json/Json.h"
+#include "base/io/log/Log.h"
+#include "base/io/log/Tags.h"
+#include "base/tools/Chrono.h"
+
+
+namespace xmrig {
+
+
+const char *LogLimiter::kField       = "log-limits";
+const char *LogLimiter::kJobRate     = "job-rate";
+const char *LogLimiter::kRejectRate  = "reject-rate";
+const char *LogLimiter::kShareRate   = "share-rate";
+const char *LogLimiter::kShareSample = "share-sample";
+
+LogLimiter::State LogLimiter::m_states[CategoryMax];
+
+
+} // namespace xmrig
+
+
+bool xmrig::LogLimiter::allow(Category category, uint32_t mapperId)
+{
+    State &state = m_states[category];
+    state.seen++;
+
+    const uint64_t now = Chrono::steadyMSecs();
+    bool allowed       = state.sample <= 1 || (state.seen % state.sample) == 0;
+
+    if (allowed && state.rate) {
+        // a bucket of one second worth of lines, refilled continuously.
+        state.tokens   = std::min<double>(state.rate, state.tokens + static_cast<double>(now - state.refilled) * state.rate / 1000.0);
+        state.refilled = now;
+
+        if (state.tokens >= 1.0) {
+            state.tokens -= 1.0;
+        }
+        else {
+            allowed = false;
+        }
+    }
+
+    if (!allowed) {
+        if (state.suppressed++ == 0) {
+            state.first = now;
+        }
+
+        state.last = now;
+        state.mappers.insert(mapperId);
+    }
+
+    return allowed;
+}
+
+
+rapidjson::Value xmrig::LogLimiter::toJSON(rapidjson::Document &doc)
+{
+    using namespace rapidjson;
+
+    auto &allocator = doc.GetAllocator();
+    Value obj(kObjectType);
+
+    obj.AddMember(StringRef(kShareSample), m_states[AcceptCategory].sample, allocator);
+    obj.AddMember(StringRef(kShareRate),   m_states[AcceptCategory].rate, allocator);
+    obj.AddMember(StringRef(kRejectRate),  m_states[RejectCategory].rate, allocator);
+    obj.AddMember(StringRef(kJobRate),     m_states[JobCategory].rate, allocator);
+
+    return obj;
+}
+
+
+void xmrig::LogLimiter::load(const rapidjson::Value &value)
+{
+    static const char *rates[CategoryMax] = { kShareRate, kRejectRate, kJobRate };
+
+    for (size_t i = 0; i < CategoryMax; ++i) {
+        m_states[i].rate   = Json::getUint(value, rates[i]);
+        m_states[i].tokens = m_states[i].rate;
+    }
+
+    m_states[AcceptCategory].sample = std::max(Json::getUint(value, kShareSample, 1), 1U);
+}
+
+
+void xmrig::LogLimiter::tick()
+{
+    for (size_t i = 0; i < CategoryMax; ++i) {
+        if (m_states[i].suppressed) {
+            print(static_cast<Category>(i), m_states[i]);
+        }
+    }
+}
+
+
+void xmrig::LogLimiter::print(Category category, State &state)
+{
+    const uint64_t elapsed = state.last - state.first;
+
+    switch (category) {
+    case AcceptCategory:
+        LOG_INFO("%s " GREEN_BOLD("%" PRIu64 " accepted") " from " WHITE_BOLD("%zu") " mappers in " WHITE_BOLD("%" PRIu64 " ms") " " BLACK_BOLD("(not shown)"),
+                 Tags::proxy(), state.suppressed, state.mappers.size(), elapsed);
+        break;
+
+    case RejectCategory:
+        LOG_INFO("%s " RED_BOLD("%" PRIu64 " rejected") " from " WHITE_BOLD("%zu") " mappers in " WHITE_BOLD("%" PRIu64 " ms") " " BLACK_BOLD("(not shown)"),
+                 Tags::proxy(), state.suppressed, state.mappers.size(), elapsed);
+        break;
+
+    case JobCategory:
+        LOG_INFO("%s " MAGENTA_BOLD("%" PRIu64 " new jobs") " from " WHITE_BOLD("%zu") " mappers in " WHITE_BOLD("%" PRIu64 " ms") " " BLACK_BOLD("(not shown)"),
+                 Tags::network(), state.suppressed, state.mappers.size(), elapsed);
+        break;
+
+    default:
+        break;
+    }
+
+    state.suppressed = 0;
+    state.mappers.clear();
+}
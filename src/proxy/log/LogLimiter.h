@@ -0,0 +1,81 @@
+/* XMRig
+ * Copyright (c) 2026      HashVault   <https://github.com/HashVault>, <root@hashvault.pro>
+ *
+ *   This program is free software: you can redistribute it and/or modify
+ *   it under the terms of the GNU General Public License as published by
+ *   the Free Software Foundation, either version 3 of the License, or
+ *   (at your option) any later version.
+ *
+ *   This program is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ *   GNU General Public License for more details.
+ *
+ *   You should have received a copy of the GNU General Public License
+ *   along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef XMRIG_LOGLIMITER_H
+#define XMRIG_LOGLIMITER_H
+
+
+#include <cstdint>
+#include <set>
+
+
+#include "3rdparty/rapidjson/fwd.h"
+
+
+namespace xmrig {
+
+
+/**
+ * Sampling (1 in N) and a per category token bucket for the per share and per job verbose lines.
+ * Lines that are not printed are counted and folded into one summary per category every tick,
+ * "N new jobs from M mappers in T ms". Only used from the event loop thread.
+ */
+class LogLimiter
+{
+public:
+    enum Category {
+        AcceptCategory,
+        RejectCategory,
+        JobCategory,
+        CategoryMax
+    };
+
+    static const char *kField;
+    static const char *kJobRate;
+    static const char *kRejectRate;
+    static const char *kShareRate;
+    static const char *kShareSample;
+
+    static bool allow(Category category, uint32_t mapperId);
+    static rapidjson::Value toJSON(rapidjson::Document &doc);
+    static void load(const rapidjson::Value &value);
+    static void tick();
+
+private:
+    struct State
+    {
+        double tokens       = 0;
+        std::set<uint32_t> mappers;
+        uint32_t rate       = 0;
+        uint32_t sample     = 1;
+        uint64_t first      = 0;
+        uint64_t last       = 0;
+        uint64_t refilled   = 0;
+        uint64_t seen       = 0;
+        uint64_t suppressed = 0;
+    };
+
+    static void print(Category category, State &state);
+
+    static State m_states[CategoryMax];
+};
+
+
+} /* namespace xmrig */
+
+
+#endif /* XMRIG_LOGLIMITER_H */
@@ -29,6 +29,8 @@
 #include "core/config/Config.h"
 #include "core/Controller.h"
 #include "proxy/events/AcceptEvent.h"
+#include "proxy/events/EventRecord.h"
+#include "proxy/log/LogLimiter.h"
 #include "proxy/Miner.h"
 #include "proxy/Stats.h"
 
@@ -46,51 +48,46 @@ xmrig::ShareLog::ShareLog(Controller *controller, Stats *stats) :
 xmrig::ShareLog::~ShareLog() = default;
 
 
-void xmrig::ShareLog::onEvent(IEvent *event)
+bool xmrig::ShareLog::capture(const IEvent *event, EventRecord &record)
 {
-    switch (event->type())
-    {
-    case IEvent::AcceptType:
-        accept(static_cast<AcceptEvent*>(event));
-        break;
-
-    default:
-        break;
+    if (event->type() != IEvent::AcceptType) {
+        return false;
     }
-}
 
+    auto e = static_cast<const AcceptEvent*>(event);
+    if (e->isDonate() || (!e->isRejected() && (!m_controller->config()->isVerbose() || e->isCustomDiff()))) {
+        return false;
+    }
 
-void xmrig::ShareLog::onRejectedEvent(IEvent *event)
-{
-    switch (event->type())
-    {
-    case IEvent::AcceptType:
-        reject(static_cast<AcceptEvent*>(event));
-        break;
-
-    default:
-        break;
+    // limited here on the loop thread, lines that are not printed never take a queue slot.
+    if (!LogLimiter::allow(e->isRejected() ? LogLimiter::RejectCategory : LogLimiter::AcceptCategory, static_cast<uint32_t>(e->mapperId()))) {
+        return false;
     }
-}
 
+    const auto &data = m_stats->data();
 
-void xmrig::ShareLog::accept(const AcceptEvent *event)
-{
-    if (!m_controller->config()->isVerbose() || event->isDonate() || event->isCustomDiff()) {
-        return;
-    }
+    record.mapperId = static_cast<uint32_t>(e->mapperId());
+    record.accepted = data.accepted;
+    record.rejects  = data.rejected;
+    record.invalid  = data.invalid;
+    record.diff     = e->result.diff;
+    record.elapsed  = e->result.elapsed;
+
+    EventRecord::set(record.ip, e->ip());
+    EventRecord::set(record.text, e->error());
 
-    LOG_INFO("%s " CYAN("%04u ") GREEN_BOLD("accepted") " (%" PRId64 "/%" PRId64 "+%" PRId64 ") diff " WHITE_BOLD("%" PRIu64) " ip " WHITE_BOLD("%s") " " BLACK_BOLD("(%" PRIu64 " ms)"),
-             Tags::proxy(), event->mapperId(), m_stats->data().accepted, m_stats->data().rejected, m_stats->data().invalid, event->result.diff, event->ip(), event->result.elapsed);
+    return true;
 }
 
 
-void xmrig::ShareLog::reject(const AcceptEvent *event)
+void xmrig::ShareLog::process(const EventRecord &record)
 {
-    if (event->isDonate()) {
-        return;
+    if (!record.rejected) {
+        LOG_INFO("%s " CYAN("%04u ") GREEN_BOLD("accepted") " (%" PRId64 "/%" PRId64 "+%" PRId64 ") diff " WHITE_BOLD("%" PRIu64) " ip " WHITE_BOLD("%s") " " BLACK_BOLD("(%" PRIu64 " ms)"),
+                 Tags::proxy(), record.mapperId, record.accepted, record.rejects, record.invalid, record.diff, record.ip, record.elapsed);
+    }
+    else {
+        LOG_INFO("%s " CYAN("%04u ") RED_BOLD("rejected") " (%" PRId64 "/%" PRId64 "+%" PRId64 ") diff " WHITE_BOLD("%" PRIu64) " ip " WHITE_BOLD("%s") " " RED("\"%s\"") " " BLACK_BOLD("(%" PRIu64 " ms)"),
+                 Tags::proxy(), record.mapperId, record.accepted, record.rejects, record.invalid, record.diff, record.ip, record.text, record.elapsed);
     }
-
-    LOG_INFO("%s " CYAN("%04u ") RED_BOLD("rejected") " (%" PRId64 "/%" PRId64 "+%" PRId64 ") diff " WHITE_BOLD("%" PRIu64) " ip " WHITE_BOLD("%s") " " RED("\"%s\"") " " BLACK_BOLD("(%" PRIu64 " ms)"),
-             Tags::proxy(), event->mapperId(), m_stats->data().accepted, m_stats->data().rejected, m_stats->data().invalid, event->result.diff, event->ip(), event->error(), event->result.elapsed);
 }
@@ -27,18 +27,17 @@
 
 
 #include "base/tools/Object.h"
-#include "proxy/interfaces/IEventListener.h"
+#include "proxy/interfaces/IEventSink.h"
 
 
 namespace xmrig {
 
 
-class AcceptEvent;
 class Controller;
 class Stats;
 
 
-class ShareLog : public IEventListener
+class ShareLog : public IEventSink
 {
 public:
     XMRIG_DISABLE_COPY_MOVE_DEFAULT(ShareLog)
@@ -47,13 +46,10 @@ public:
     ~ShareLog() override;
 
 protected:
-    void onEvent(IEvent *event) override;
-    void onRejectedEvent(IEvent *event) override;
+    bool capture(const IEvent *event, EventRecord &record) override;
+    void process(const EventRecord &record) override;
 
 private:
-    void accept(const AcceptEvent *event);
-    void reject(const AcceptEvent *event);
-
     Stats *m_stats;
     Controller *m_controller;
 };
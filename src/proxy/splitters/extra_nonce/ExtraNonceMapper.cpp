@@ -35,15 +35,19 @@
 #include "core/Controller.h"
 #include "net/JobResult.h"
 #include "net/strategies/DonateStrategy.h"
+#include "proxy/Counters.h"
 #include "proxy/Error.h"
 #include "proxy/events/AcceptEvent.h"
 #include "proxy/events/SubmitEvent.h"
+#include "proxy/log/LogLimiter.h"
 #include "proxy/Miner.h"
+#include "proxy/Profiler.h"
 #include "proxy/splitters/extra_nonce/ExtraNonceStorage.h"
 
 
-xmrig::ExtraNonceMapper::ExtraNonceMapper(size_t, Controller *controller) :
-    m_controller(controller)
+xmrig::ExtraNonceMapper::ExtraNonceMapper(size_t id, Controller *controller) :
+    m_controller(controller),
+    m_id(id)
 {
     m_storage  = new ExtraNonceStorage();
     m_strategy = controller->config()->pools().createStrategy(this);
@@ -195,6 +199,12 @@ void xmrig::ExtraNonceMapper::onActive(IStrategy *strategy, IClient *client)
 }
 
 
+void xmrig::ExtraNonceMapper::onFailover(IStrategy *, IClient *client, uint64_t gap)
+{
+    Counters::addFailover(m_id, client, gap, m_controller->config()->isVerbose());
+}
+
+
 void xmrig::ExtraNonceMapper::onJob(IStrategy *, IClient *client, const Job &job, const rapidjson::Value &)
 {
     if (m_donate) {
@@ -230,7 +240,7 @@ void xmrig::ExtraNonceMapper::onResultAccepted(IStrategy *, IClient *client, con
 {
     const SubmitCtx ctx = submitCtx(result.seq);
 
-    AcceptEvent::start(0, ctx.miner, result, client->id() == -1, false, error);
+    AcceptEvent::start(0, ctx.miner, result, client->id() == -1, false, error, client->pool().url().data());
 
     if (!ctx.miner) {
         return;
@@ -242,6 +252,7 @@ void xmrig::ExtraNonceMapper::onResultAccepted(IStrategy *, IClient *client, con
     else {
         ctx.miner->success(ctx.id, "OK");
     }
+    PROFILE_SHARE(result);
 }
 
 
@@ -282,7 +293,7 @@ void xmrig::ExtraNonceMapper::connect()
 
 void xmrig::ExtraNonceMapper::setJob(const char *host, int port, const Job &job)
 {
-    if (m_controller->config()->isVerbose()) {
+    if (m_controller->config()->isVerbose() && LogLimiter::allow(LogLimiter::JobCategory, 0)) {
         LOG_INFO("%s " CYAN("%04u ") MAGENTA_BOLD("new job") " from " WHITE_BOLD("%s:%d") " diff " WHITE_BOLD("%" PRIu64) " algo " WHITE_BOLD("%s") " height " WHITE_BOLD("%" PRIu64),
                  Tags::network(), 0, host, port, job.diff(), job.algorithm().name(), job.height());
     }
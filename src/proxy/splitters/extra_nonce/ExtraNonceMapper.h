@@ -87,6 +87,7 @@ public:
 
 protected:
     void onActive(IStrategy *strategy, IClient *client) override;
+    void onFailover(IStrategy *strategy, IClient *client, uint64_t gap) override;
     void onJob(IStrategy *strategy, IClient *client, const Job &job, const rapidjson::Value &params) override;
     void onLogin(IStrategy *strategy, IClient *client, rapidjson::Document &doc, rapidjson::Value &params) override;
     void onPause(IStrategy *strategy) override;
@@ -105,6 +106,7 @@ private:
     IStrategy *m_pending        = nullptr;
     IStrategy *m_strategy;
     ExtraNonceStorage *m_storage;
+    size_t m_id;
     std::map<int64_t, SubmitCtx> m_results;
 };
 
@@ -55,6 +55,7 @@ protected:
     Upstreams upstreams() const override;
     void connect() override;
     void gc() override;
+    inline void getPools(rapidjson::Value &, rapidjson::Document &) const override {}
     void printConnections() override;
     void tick(uint64_t ticks) override;
 
@@ -35,19 +35,25 @@
 #include "core/Controller.h"
 #include "net/JobResult.h"
 #include "net/strategies/DonateStrategy.h"
+#include "proxy/Counters.h"
 #include "proxy/Error.h"
 #include "proxy/events/AcceptEvent.h"
 #include "proxy/events/SubmitEvent.h"
+#include "proxy/log/LogLimiter.h"
 #include "proxy/Miner.h"
+#include "proxy/Profiler.h"
+#include "proxy/splitters/nicehash/NonceRouter.h"
 #include "proxy/splitters/nicehash/NonceStorage.h"
 
 
-xmrig::NonceMapper::NonceMapper(size_t id, Controller *controller) :
+xmrig::NonceMapper::NonceMapper(size_t id, Controller *controller, NonceRouter *router, size_t route) :
     m_controller(controller),
-    m_id(id)
+    m_router(router),
+    m_id(id),
+    m_route(route)
 {
     m_storage  = new NonceStorage();
-    m_strategy = controller->config()->pools().createStrategy(this);
+    m_strategy = controller->config()->pools().createStrategy(this, primary());
 
     if (controller->config()->pools().donateLevel() > 0) {
         m_donate = new DonateStrategy(controller, this);
@@ -90,6 +96,18 @@ bool xmrig::NonceMapper::isActive() const
 }
 
 
+size_t xmrig::NonceMapper::miners() const
+{
+    return m_storage->size();
+}
+
+
+uint32_t xmrig::NonceMapper::usage() const
+{
+    return static_cast<uint32_t>((256 - m_storage->available()) * 100 / 256);
+}
+
+
 void xmrig::NonceMapper::gc()
 {
     if (isSuspended()) {
@@ -109,7 +127,7 @@ void xmrig::NonceMapper::reload(const Pools &pools)
 {
     delete m_pending;
 
-    m_pending = pools.createStrategy(this);
+    m_pending = pools.createStrategy(this, primary());
     m_pending->connect();
 }
 
@@ -205,6 +223,12 @@ void xmrig::NonceMapper::onActive(IStrategy *strategy, IClient *client)
 }
 
 
+void xmrig::NonceMapper::onFailover(IStrategy *, IClient *client, uint64_t gap)
+{
+    Counters::addFailover(m_id, client, gap, m_controller->config()->isVerbose());
+}
+
+
 void xmrig::NonceMapper::onJob(IStrategy *, IClient *client, const Job &job, const rapidjson::Value &)
 {
     if (m_donate) {
@@ -240,7 +264,16 @@ void xmrig::NonceMapper::onResultAccepted(IStrategy *, IClient *client, const Su
 {
     const SubmitCtx ctx = submitCtx(result.seq);
 
-    AcceptEvent::start(m_id, ctx.miner, result, client->id() == -1, false, error);
+    AcceptEvent::start(m_id, ctx.miner, result, client->id() == -1, false, error, client->pool().url().data());
+
+    if (m_router && m_router->isEnabled() && client->id() != -1) {
+        if (error) {
+            m_router->reject(client->pool().url());
+        }
+        else {
+            m_router->accept(client->pool().url(), result.diff, result.elapsed);
+        }
+    }
 
     if (!ctx.miner) {
         return;
@@ -252,6 +285,7 @@ void xmrig::NonceMapper::onResultAccepted(IStrategy *, IClient *client, const Su
     else {
         ctx.miner->success(ctx.id, "OK");
     }
+    PROFILE_SHARE(result);
 }
 
 
@@ -279,6 +313,12 @@ xmrig::SubmitCtx xmrig::NonceMapper::submitCtx(int64_t seq)
 }
 
 
+size_t xmrig::NonceMapper::primary() const
+{
+    return m_router && m_router->isEnabled() ? m_router->pool(m_route) : 0;
+}
+
+
 void xmrig::NonceMapper::connect()
 {
     m_suspended = 0;
@@ -292,7 +332,7 @@ void xmrig::NonceMapper::connect()
 
 void xmrig::NonceMapper::setJob(const char *host, int port, const Job &job)
 {
-    if (m_controller->config()->isVerbose()) {
+    if (m_controller->config()->isVerbose() && LogLimiter::allow(LogLimiter::JobCategory, static_cast<uint32_t>(m_id))) {
         LOG_INFO("%s " CYAN("%04u ") MAGENTA_BOLD("new job") " from " WHITE_BOLD("%s:%d") " diff " WHITE_BOLD("%" PRIu64) " algo " WHITE_BOLD("%s") " height " WHITE_BOLD("%" PRIu64),
                  Tags::network(), m_id, host, port, job.diff(), job.algorithm().name(), job.height());
     }
@@ -44,6 +44,7 @@ class DonateStrategy;
 class IStrategy;
 class JobResult;
 class Miner;
+class NonceRouter;
 class NonceStorage;
 class Pools;
 class SubmitEvent;
@@ -66,11 +67,13 @@ class NonceMapper : public IStrategyListener
 public:
     XMRIG_DISABLE_COPY_MOVE_DEFAULT(NonceMapper)
 
-    NonceMapper(size_t id, Controller *controller);
+    NonceMapper(size_t id, Controller *controller, NonceRouter *router = nullptr, size_t route = 0);
     ~NonceMapper() override;
 
     bool add(Miner *miner);
     bool isActive() const;
+    size_t miners() const;
+    uint32_t usage() const;
     void gc();
     void reload(const Pools &pools);
     void remove(const Miner *miner);
@@ -78,8 +81,10 @@ public:
     void submit(SubmitEvent *event);
     void tick(uint64_t ticks, uint64_t now);
 
-    inline bool isSuspended() const { return m_suspended > 0; }
-    inline int suspended() const    { return m_suspended; }
+    inline bool isSuspended() const     { return m_suspended > 0; }
+    inline int suspended() const        { return m_suspended; }
+    inline size_t route() const         { return m_route; }
+    inline void setRoute(size_t route)  { m_route = route; }
 
 #   ifdef APP_DEVEL
     void printState();
@@ -87,6 +92,7 @@ public:
 
 protected:
     void onActive(IStrategy *strategy, IClient *client) override;
+    void onFailover(IStrategy *strategy, IClient *client, uint64_t gap) override;
     void onJob(IStrategy *strategy, IClient *client, const Job &job, const rapidjson::Value &params) override;
     void onLogin(IStrategy *strategy, IClient *client, rapidjson::Document &doc, rapidjson::Value &params) override;
     void onPause(IStrategy *strategy) override;
@@ -95,6 +101,7 @@ protected:
 
 private:
     SubmitCtx submitCtx(int64_t seq);
+    size_t primary() const;
     void connect();
     void setJob(const char *host, int port, const Job &job);
     void suspend();
@@ -104,8 +111,10 @@ private:
     int m_suspended             = 0;
     IStrategy *m_pending        = nullptr;
     IStrategy *m_strategy;
+    NonceRouter *m_router;
     NonceStorage *m_storage;
     size_t m_id;
+    size_t m_route;
     std::map<int64_t, SubmitCtx> m_results;
 };
 
@@ -0,0 +1,162 @@
+/* XMRig
+ * Copyright (c) 2026      HashVault   <https://github.com/HashVault>, <root@hashvault.pro>
+ *
+ *   This program is free software: you can redistribute it and/or modify
+ *   it under the terms of the GNU General Public License as published by
+ *   the Free Software Foundation, either version 3 of the License, or
+ *   (at your option) any later version.
+ *
+ *   This program is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ *   GNU General Public License for more details.
+ *
+ *   You should have received a copy of the GNU General Public License
+ *   along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#include "proxy/splitters/nicehash/NonceRouter.h"
+#include "3rdparty/rapidjson/document.h"
+#include "base/net/stratum/Pools.h"
+
+
+#include <algorithm>
+
+
+namespace xmrig {
+
+
+constexpr double NonceRouter::kMaxCorrection;
+
+
+} // namespace xmrig
+
+
+rapidjson::Value xmrig::NonceRouter::toJSON(rapidjson::Document &doc) const
+{
+    using namespace rapidjson;
+    auto &allocator = doc.GetAllocator();
+
+    Value out(kArrayType);
+
+    for (const Route &route : m_routes) {
+        Value obj(kObjectType);
+        obj.AddMember("url",      route.url.toJSON(), allocator);
+        obj.AddMember("weight",   route.weight, allocator);
+        obj.AddMember("share",    m_hashes ? static_cast<double>(route.hashes) / m_hashes : 0.0, allocator);
+        obj.AddMember("mappers",  route.mappers, allocator);
+        obj.AddMember("miners",   route.miners, allocator);
+        obj.AddMember("accepted", route.accepted, allocator);
+        obj.AddMember("rejected", route.rejected, allocator);
+        obj.AddMember("hashes",   route.hashes, allocator);
+        obj.AddMember("latency",  route.latency.toJSON(doc), allocator);
+
+        out.PushBack(obj, allocator);
+    }
+
+    return out;
+}
+
+
+size_t xmrig::NonceRouter::select() const
+{
+    size_t best       = 0;
+    double bestScore  = 0.0;
+
+    for (size_t i = 0; i < m_routes.size(); ++i) {
+        const Route &route = m_routes[i];
+        double weight      = route.weight;
+
+        // routes that delivered less than their share of hashes get proportionally more miners.
+        if (m_hashes && route.hashes) {
+            const double target = static_cast<double>(route.weight) / m_weight;
+            const double actual = static_cast<double>(route.hashes) / m_hashes;
+
+            weight *= std::min(std::max(target / actual, 1.0 / kMaxCorrection), kMaxCorrection);
+        }
+
+        const double score = (route.miners + 1) / weight;
+        if (i == 0 || score < bestScore) {
+            best      = i;
+            bestScore = score;
+        }
+    }
+
+    return best;
+}
+
+
+void xmrig::NonceRouter::accept(const String &url, uint64_t diff, uint64_t elapsed)
+{
+    Route *route = find(url);
+    if (!route) {
+        return;
+    }
+
+    route->accepted++;
+    route->hashes += diff;
+    route->latency.add(elapsed);
+    m_hashes      += diff;
+}
+
+
+void xmrig::NonceRouter::load(const Pools &pools)
+{
+    std::vector<Route> routes;
+    size_t index    = 0;
+    uint64_t weight = 0;
+
+    for (const Pool &pool : pools.data()) {
+        if (!pool.isEnabled()) {
+            continue;
+        }
+
+        if (pool.weight() > 0) {
+            routes.emplace_back(pool.url(), index, pool.weight());
+            weight += pool.weight();
+        }
+
+        index++;
+    }
+
+    // keep share counters of pools that survived the reload, mapper and miner counts are rebuilt by the splitter.
+    for (Route &route : routes) {
+        const Route *prev = find(route.url);
+        if (prev) {
+            route.accepted = prev->accepted;
+            route.hashes   = prev->hashes;
+            route.latency  = prev->latency;
+            route.rejected = prev->rejected;
+        }
+    }
+
+    m_routes = std::move(routes);
+    m_weight = weight;
+    m_hashes = 0;
+
+    for (const Route &route : m_routes) {
+        m_hashes += route.hashes;
+    }
+}
+
+
+void xmrig::NonceRouter::reject(const String &url)
+{
+    Route *route = find(url);
+    if (route) {
+        route->rejected++;
+    }
+}
+
+
+xmrig::NonceRouter::Route *xmrig::NonceRouter::find(const String &url)
+{
+    for (Route &route : m_routes) {
+        if (route.url == url) {
+            return &route;
+        }
+    }
+
+    return nullptr;
+}
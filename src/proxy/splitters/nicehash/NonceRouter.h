@@ -0,0 +1,92 @@
+/* XMRig
+ * Copyright (c) 2026      HashVault   <https://github.com/HashVault>, <root@hashvault.pro>
+ *
+ *   This program is free software: you can redistribute it and/or modify
+ *   it under the terms of the GNU General Public License as published by
+ *   the Free Software Foundation, either version 3 of the License, or
+ *   (at your option) any later version.
+ *
+ *   This program is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ *   GNU General Public License for more details.
+ *
+ *   You should have received a copy of the GNU General Public License
+ *   along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef XMRIG_NONCEROUTER_H
+#define XMRIG_NONCEROUTER_H
+
+
+#include <cstdint>
+#include <vector>
+
+
+#include "3rdparty/rapidjson/fwd.h"
+#include "base/tools/String.h"
+#include "proxy/Histogram.h"
+
+
+namespace xmrig {
+
+
+class Pools;
+
+
+/**
+ * Weighted pool routing for the nicehash splitter, each enabled pool with non zero "weight" is a route.
+ * New miners go to the route with the lowest miners-per-weight, corrected by how far the realized
+ * accepted hashes of that route are from its weight share. Pools without weight stay failover only.
+ */
+class NonceRouter
+{
+public:
+    NonceRouter() = default;
+
+    inline bool isEnabled() const                           { return m_routes.size() > 1; }
+    inline size_t pool(size_t route) const                  { return route < m_routes.size() ? m_routes[route].pool : 0; }
+    inline size_t size() const                              { return m_routes.size(); }
+
+    inline void add(size_t route, uint64_t miners = 1)      { if (route < m_routes.size()) { m_routes[route].miners += miners; } }
+    inline void addMapper(size_t route)                     { if (route < m_routes.size()) { m_routes[route].mappers++; } }
+    inline void remove(size_t route)                        { if (route < m_routes.size() && m_routes[route].miners) { m_routes[route].miners--; } }
+    inline void removeMapper(size_t route)                  { if (route < m_routes.size() && m_routes[route].mappers) { m_routes[route].mappers--; } }
+
+    rapidjson::Value toJSON(rapidjson::Document &doc) const;
+    size_t select() const;
+    void accept(const String &url, uint64_t diff, uint64_t elapsed);
+    void load(const Pools &pools);
+    void reject(const String &url);
+
+private:
+    constexpr static double kMaxCorrection = 2.0;
+
+    class Route
+    {
+    public:
+        inline Route(const String &url, size_t pool, uint32_t weight) : url(url), pool(pool), weight(weight) {}
+
+        Histogram latency;
+        String url;
+        size_t pool;
+        uint32_t weight;
+        uint64_t accepted   = 0;
+        uint64_t hashes     = 0;
+        uint64_t mappers    = 0;
+        uint64_t miners     = 0;
+        uint64_t rejected   = 0;
+    };
+
+    Route *find(const String &url);
+
+    std::vector<Route> m_routes;
+    uint64_t m_hashes   = 0;
+    uint64_t m_weight   = 0;
+};
+
+
+} /* namespace xmrig */
+
+
+#endif /* XMRIG_NONCEROUTER_H */
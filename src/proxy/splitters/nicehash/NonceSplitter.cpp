@@ -23,6 +23,7 @@
  */
 
 #include "proxy/splitters/nicehash/NonceSplitter.h"
+#include "3rdparty/rapidjson/document.h"
 #include "base/io/log/Log.h"
 #include "base/tools/Chrono.h"
 #include "core/config/Config.h"
@@ -41,8 +42,11 @@
 #define LABEL(x) " \x1B[01;30m" x ":\x1B[0m "
 
 
-xmrig::NonceSplitter::NonceSplitter(Controller *controller) : Splitter(controller)
+xmrig::NonceSplitter::NonceSplitter(Controller *controller) : Splitter(controller),
+    m_spare(controller->config()->spareUpstreams()),
+    m_spareThreshold(controller->config()->spareThreshold())
 {
+    m_router.load(controller->config()->pools());
 }
 
 
@@ -77,20 +81,26 @@ xmrig::Upstreams xmrig::NonceSplitter::upstreams() const
 
 void xmrig::NonceSplitter::connect()
 {
-    auto *upstream = new NonceMapper(m_upstreams.size(), m_controller);
-    m_upstreams.push_back(upstream);
-
-    upstream->start();
+    connect(m_router.isEnabled() ? m_router.select() : 0);
 }
 
 
 void xmrig::NonceSplitter::gc()
 {
+    uint32_t spare = 0;
+
     for (NonceMapper *mapper : m_upstreams) {
+        // pre-warmed upstreams must stay connected even without miners.
+        if (spare < m_spare && isSpare(mapper)) {
+            spare++;
+            continue;
+        }
+
         mapper->gc();
     }
 
     while (m_upstreams.back()->suspended() >= 2) {
+        m_router.removeMapper(m_upstreams.back()->route());
         delete m_upstreams.back();
 
         m_upstreams.pop_back();
@@ -98,6 +108,14 @@ void xmrig::NonceSplitter::gc()
 }
 
 
+void xmrig::NonceSplitter::getPools(rapidjson::Value &reply, rapidjson::Document &doc) const
+{
+    if (m_router.isEnabled()) {
+        reply.AddMember("pools", m_router.toJSON(doc), doc.GetAllocator());
+    }
+}
+
+
 void xmrig::NonceSplitter::printConnections()
 {
     const auto info  = upstreams();
@@ -118,6 +136,8 @@ void xmrig::NonceSplitter::tick(uint64_t ticks)
     for (NonceMapper *mapper : m_upstreams) {
         mapper->tick(ticks, now);
     }
+
+    prewarm();
 }
 
 
@@ -133,10 +153,22 @@ void xmrig::NonceSplitter::printState()
 
 void xmrig::NonceSplitter::onConfigChanged(Config *config, Config *previousConfig)
 {
+    m_spare          = config->spareUpstreams();
+    m_spareThreshold = config->spareThreshold();
+
     if (config->pools() != previousConfig->pools()) {
         config->pools().print();
 
+        m_router.load(config->pools());
+
         for (NonceMapper *mapper : m_upstreams) {
+            if (mapper->route() >= m_router.size()) {
+                mapper->setRoute(m_router.isEnabled() ? m_router.select() : 0);
+            }
+
+            m_router.addMapper(mapper->route());
+            m_router.add(mapper->route(), mapper->miners());
+
             mapper->reload(config->pools());
         }
     }
@@ -165,28 +197,86 @@ void xmrig::NonceSplitter::onEvent(IEvent *event)
 }
 
 
+bool xmrig::NonceSplitter::isSpare(const NonceMapper *mapper) const
+{
+    return !mapper->isSuspended() && mapper->usage() < m_spareThreshold;
+}
+
+
+bool xmrig::NonceSplitter::add(Miner *miner, bool suspended, bool any, size_t route)
+{
+    for (NonceMapper *mapper : m_upstreams) {
+        if (mapper->isSuspended() != suspended || (!any && mapper->route() != route)) {
+            continue;
+        }
+
+        if (mapper->add(miner)) {
+            m_router.add(mapper->route());
+            return true;
+        }
+    }
+
+    return false;
+}
+
+
+void xmrig::NonceSplitter::connect(size_t route)
+{
+    auto *upstream = new NonceMapper(m_upstreams.size(), m_controller, &m_router, route);
+    m_upstreams.push_back(upstream);
+    m_router.addMapper(route);
+
+    upstream->start();
+}
+
+
 void xmrig::NonceSplitter::login(LoginEvent *event)
 {
     if (event->miner()->routeId() != -1) {
         return;
     }
 
-    // try reuse active upstreams.
-    for (NonceMapper *mapper : m_upstreams) {
-        if (!mapper->isSuspended() && mapper->add(event->miner())) {
-            return;
+    const bool any     = !m_router.isEnabled();
+    const size_t route = any ? 0 : m_router.select();
+
+    // try reuse active upstreams, then suspended ones, with weighted routing only upstreams of the selected pool match.
+    if (add(event->miner(), false, any, route) || add(event->miner(), true, any, route)) {
+        return;
+    }
+
+    connect(route);
+    login(event);
+}
+
+
+void xmrig::NonceSplitter::prewarm()
+{
+    if (m_spare == 0) {
+        return;
+    }
+
+    uint32_t spare = 0;
+    for (const NonceMapper *mapper : m_upstreams) {
+        if (isSpare(mapper)) {
+            spare++;
         }
     }
 
-    // try reuse suspended upstreams.
+    // wake up suspended upstreams first, they keep their place in the list.
     for (NonceMapper *mapper : m_upstreams) {
-        if (mapper->isSuspended() && mapper->add(event->miner())) {
+        if (spare >= m_spare) {
             return;
         }
+
+        if (mapper->isSuspended()) {
+            mapper->start();
+            spare++;
+        }
     }
 
-    connect();
-    login(event);
+    for (; spare < m_spare; ++spare) {
+        connect();
+    }
 }
 
 
@@ -197,6 +287,7 @@ void xmrig::NonceSplitter::remove(Miner *miner)
     }
 
     m_upstreams[miner->mapperId()]->remove(miner);
+    m_router.remove(m_upstreams[miner->mapperId()]->route());
 }
 
 
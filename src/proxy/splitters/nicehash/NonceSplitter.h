@@ -31,6 +31,7 @@
 
 
 #include "base/tools/Object.h"
+#include "proxy/splitters/nicehash/NonceRouter.h"
 #include "proxy/splitters/Splitter.h"
 
 
@@ -57,6 +58,7 @@ protected:
     Upstreams upstreams() const override;
     void connect() override;
     void gc() override;
+    void getPools(rapidjson::Value &reply, rapidjson::Document &doc) const override;
     void printConnections() override;
     void tick(uint64_t ticks) override;
 
@@ -69,11 +71,18 @@ protected:
     void onEvent(IEvent *event) override;
 
 private:
+    bool add(Miner *miner, bool suspended, bool any, size_t route);
+    bool isSpare(const NonceMapper *mapper) const;
+    void connect(size_t route);
     void login(LoginEvent *event);
+    void prewarm();
     void remove(Miner *miner);
     void submit(SubmitEvent *event);
 
+    NonceRouter m_router;
     std::vector<NonceMapper*> m_upstreams;
+    uint32_t m_spare;
+    uint32_t m_spareThreshold;
 };
 
 
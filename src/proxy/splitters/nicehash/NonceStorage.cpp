@@ -28,6 +28,7 @@
 #include "proxy/splitters/nicehash/NonceStorage.h"
 
 
+#include <algorithm>
 #include <cinttypes>
 
 
@@ -100,6 +101,12 @@ xmrig::Miner *xmrig::NonceStorage::miner(int64_t id)
 }
 
 
+size_t xmrig::NonceStorage::available() const
+{
+    return static_cast<size_t>(std::count(m_used.begin(), m_used.end(), 0));
+}
+
+
 void xmrig::NonceStorage::remove(const Miner *miner)
 {
     m_used[miner->fixedByte()] = -miner->id();
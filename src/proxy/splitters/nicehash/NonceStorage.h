@@ -52,12 +52,14 @@ public:
     bool isUsed() const;
     bool isValidJobId(const String &id) const;
     Miner *miner(int64_t id);
+    size_t available() const;
     void remove(const Miner *miner);
     void reset();
     void setJob(const Job &job);
 
     inline bool isActive() const       { return m_active; }
     inline const Job &job() const      { return m_job; }
+    inline size_t size() const         { return m_miners.size(); }
     inline void setActive(bool active) { m_active = active; }
 
 #   ifdef APP_DEVEL
@@ -35,7 +35,9 @@
 #include "proxy/Error.h"
 #include "proxy/events/AcceptEvent.h"
 #include "proxy/events/SubmitEvent.h"
+#include "proxy/log/LogLimiter.h"
 #include "proxy/Miner.h"
+#include "proxy/Profiler.h"
 
 
 #include <cinttypes>
@@ -59,12 +61,7 @@ xmrig::SimpleMapper::~SimpleMapper()
 
 void xmrig::SimpleMapper::add(Miner *miner)
 {
-    m_miner = miner;
-
-    m_miner->setExtension(Miner::EXT_ALGO,     m_controller->config()->hasAlgoExt());
-    m_miner->setExtension(Miner::EXT_NICEHASH, false);
-    m_miner->setMapperId(static_cast<ssize_t>(m_id));
-
+    reuse(miner);
     connect();
 }
 
@@ -89,7 +86,21 @@ void xmrig::SimpleMapper::reuse(Miner *miner)
 {
     m_idleTime = 0;
     m_miner    = miner;
+
+    m_miner->setExtension(Miner::EXT_ALGO,     m_controller->config()->hasAlgoExt());
+    m_miner->setExtension(Miner::EXT_NICEHASH, false);
     m_miner->setMapperId(static_cast<ssize_t>(m_id));
+
+    // connection is already logged in, send the current job without waiting for the next one from the pool.
+    if (m_active && m_job.isValid()) {
+        m_miner->setJob(m_job);
+    }
+}
+
+
+void xmrig::SimpleMapper::start()
+{
+    connect();
 }
 
 
@@ -175,9 +186,15 @@ void xmrig::SimpleMapper::onActive(IStrategy *strategy, IClient *client)
 }
 
 
+void xmrig::SimpleMapper::onFailover(IStrategy *, IClient *client, uint64_t gap)
+{
+    Counters::addFailover(m_id, client, gap, m_controller->config()->isVerbose());
+}
+
+
 void xmrig::SimpleMapper::onJob(IStrategy *, IClient *client, const Job &job, const rapidjson::Value &)
 {
-    if (m_controller->config()->isVerbose()) {
+    if (m_controller->config()->isVerbose() && LogLimiter::allow(LogLimiter::JobCategory, static_cast<uint32_t>(m_id))) {
         LOG_INFO("%s " CYAN("%04u ") MAGENTA_BOLD("new job") " from " WHITE_BOLD("%s:%d") " diff " WHITE_BOLD("%" PRIu64) " algo " WHITE_BOLD("%s") " height " WHITE_BOLD("%" PRIu64),
                  Tags::network(), m_id, client->pool().host().data(), client->pool().port(), job.diff(), job.algorithm().name(), job.height());
     }
@@ -206,7 +223,7 @@ void xmrig::SimpleMapper::onPause(IStrategy *strategy)
 
 void xmrig::SimpleMapper::onResultAccepted(IStrategy *, IClient *client, const SubmitResult &result, const char *error)
 {
-    AcceptEvent::start(m_id, m_miner, result, client->id() == -1, false, error);
+    AcceptEvent::start(m_id, m_miner, result, client->id() == -1, false, error, client->pool().url().data());
 
     if (!m_miner) {
         return;
@@ -218,6 +235,7 @@ void xmrig::SimpleMapper::onResultAccepted(IStrategy *, IClient *client, const S
     else {
         m_miner->success(result.reqId, "OK");
     }
+    PROFILE_SHARE(result);
 }
 
 
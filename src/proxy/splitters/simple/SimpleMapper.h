@@ -61,17 +61,20 @@ public:
     void reload(const Pools &pools);
     void remove(const Miner *miner);
     void reuse(Miner *miner);
+    void start();
     void stop();
     void submit(SubmitEvent *event);
     void tick(uint64_t ticks, uint64_t now);
 
     inline bool isActive() const     { return m_active && m_miner; }
     inline bool isReusable() const   { return m_active && !m_miner && !m_dirty; }
+    inline bool isSpare() const      { return !m_miner && !m_dirty; }
     inline uint64_t id() const       { return m_id; }
     inline uint64_t idleTime() const { return m_idleTime; }
 
 protected:
     void onActive(IStrategy *strategy, IClient *client) override;
+    void onFailover(IStrategy *strategy, IClient *client, uint64_t gap) override;
     void onJob(IStrategy *strategy, IClient *client, const Job &job, const rapidjson::Value &params) override;
     void onLogin(IStrategy *strategy, IClient *client, rapidjson::Document &doc, rapidjson::Value &params) override;
     void onPause(IStrategy *strategy) override;
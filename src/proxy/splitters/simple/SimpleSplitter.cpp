@@ -42,6 +42,7 @@
 
 
 xmrig::SimpleSplitter::SimpleSplitter(xmrig::Controller *controller) : Splitter(controller),
+    m_spare(controller->config()->spareUpstreams()),
     m_reuseTimeout(static_cast<uint64_t>(controller->config()->reuseTimeout()))
 {
 }
@@ -104,8 +105,13 @@ void xmrig::SimpleSplitter::tick(uint64_t ticks)
     }
     m_released.clear();
 
+    uint32_t spare = 0;
+
     for (auto const &kv : m_upstreams) {
-        if (kv.second->idleTime() > m_reuseTimeout) {
+        if (spare < m_spare && kv.second->isSpare()) {
+            spare++;
+        }
+        else if (kv.second->idleTime() > m_reuseTimeout) {
             m_released.push_back(kv.second);
             continue;
         }
@@ -113,13 +119,11 @@ void xmrig::SimpleSplitter::tick(uint64_t ticks)
         kv.second->tick(ticks, now);
     }
 
-    if (m_released.empty()) {
-        return;
-    }
-
     for (SimpleMapper *mapper : m_released) {
         stop(mapper);
     }
+
+    prewarm(spare);
 }
 
 
@@ -133,6 +137,7 @@ void xmrig::SimpleSplitter::printState()
 void xmrig::SimpleSplitter::onConfigChanged(Config *config, Config *previousConfig)
 {
     m_reuseTimeout = static_cast<uint64_t>(config->reuseTimeout());
+    m_spare        = config->spareUpstreams();
 
     if (config->pools() != previousConfig->pools()) {
         config->pools().print();
@@ -190,6 +195,18 @@ void xmrig::SimpleSplitter::login(LoginEvent *event)
 }
 
 
+void xmrig::SimpleSplitter::prewarm(uint32_t spare)
+{
+    for (; spare < m_spare; ++spare) {
+        auto mapper = new SimpleMapper(m_sequence++, m_controller);
+        m_upstreams[mapper->id()] = mapper;
+        m_idles[mapper->id()]     = mapper;
+
+        mapper->start();
+    }
+}
+
+
 void xmrig::SimpleSplitter::stop(SimpleMapper *mapper)
 {
     removeIdle(mapper->id());
@@ -53,6 +53,7 @@ protected:
     Upstreams upstreams() const override;
     void connect() override;
     void gc() override;
+    inline void getPools(rapidjson::Value &, rapidjson::Document &) const override {}
     void printConnections() override;
     void tick(uint64_t ticks) override;
 
@@ -66,6 +67,7 @@ protected:
 
 private:
     void login(LoginEvent *event);
+    void prewarm(uint32_t spare);
     void remove(Miner *miner);
     void removeIdle(uint64_t id);
     void removeUpstream(uint64_t id);
@@ -75,6 +77,7 @@ private:
     std::map<uint64_t, SimpleMapper *> m_idles;
     std::map<uint64_t, SimpleMapper *> m_upstreams;
     std::vector<SimpleMapper *> m_released;
+    uint32_t m_spare        = 0;
     uint64_t m_reuseTimeout = 0;
     uint64_t m_sequence     = 0;
 };
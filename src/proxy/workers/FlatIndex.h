@@ -0,0 +1,192 @@
+/* XMRig
+ * Copyright (c) 2026      HashVault   <https://github.com/HashVault>, <root@hashvault.pro>
+ *
+ *   This program is free software: you can redistribute it and/or modify
+ *   it under the terms of the GNU General Public License as published by
+ *   the Free Software Foundation, either version 3 of the License, or
+ *   (at your option) any later version.
+ *
+ *   This program is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ *   GNU General Public License for more details.
+ *
+ *   You should have received a copy of the GNU General Public License
+ *   along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef XMRIG_FLATINDEX_H
+#define XMRIG_FLATINDEX_H
+
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <vector>
+
+
+namespace xmrig {
+
+
+/**
+ * Open addressing hash index from a key to a position, linear probing over one flat array
+ * with backward shift deletion, so lookups never walk over tombstones.
+ */
+template <class K, class H = std::hash<K>> class FlatIndex
+{
+public:
+    constexpr static size_t npos = SIZE_MAX;
+
+    inline size_t size() const { return m_size; }
+
+
+    inline size_t find(const K &key) const
+    {
+        if (m_size == 0) {
+            return npos;
+        }
+
+        for (size_t i = bucket(key);; i = (i + 1) & mask()) {
+            const Slot &slot = m_slots[i];
+            if (!slot.used) {
+                return npos;
+            }
+
+            if (slot.key == key) {
+                return slot.value;
+            }
+        }
+    }
+
+
+    inline void insert(const K &key, size_t value)
+    {
+        if ((m_size + 1) * 4 > m_slots.size() * 3) {
+            rehash(m_slots.empty() ? 16 : m_slots.size() * 2);
+        }
+
+        for (size_t i = bucket(key);; i = (i + 1) & mask()) {
+            Slot &slot = m_slots[i];
+            if (!slot.used) {
+                slot.key   = key;
+                slot.value = value;
+                slot.used  = true;
+                m_size++;
+
+                return;
+            }
+
+            if (slot.key == key) {
+                slot.value = value;
+
+                return;
+            }
+        }
+    }
+
+
+    inline bool erase(const K &key)
+    {
+        if (m_size == 0) {
+            return false;
+        }
+
+        size_t i = bucket(key);
+        for (;; i = (i + 1) & mask()) {
+            if (!m_slots[i].used) {
+                return false;
+            }
+
+            if (m_slots[i].key == key) {
+                break;
+            }
+        }
+
+        // pull back every following entry that would become unreachable through the new hole.
+        for (size_t j = (i + 1) & mask();; j = (j + 1) & mask()) {
+            if (!m_slots[j].used) {
+                break;
+            }
+
+            const size_t home = bucket(m_slots[j].key);
+            if (((j - home) & mask()) >= ((j - i) & mask())) {
+                m_slots[i] = std::move(m_slots[j]);
+                i = j;
+            }
+        }
+
+        m_slots[i] = Slot();
+        m_size--;
+
+        return true;
+    }
+
+
+    inline void clear()
+    {
+        m_slots.clear();
+        m_size = 0;
+    }
+
+
+    template <typename F> inline void forEach(F fn)
+    {
+        for (Slot &slot : m_slots) {
+            if (slot.used) {
+                fn(static_cast<const K &>(slot.key), slot.value);
+            }
+        }
+    }
+
+
+private:
+    struct Slot
+    {
+        K key {};
+        size_t value = 0;
+        bool used    = false;
+    };
+
+
+    inline size_t bucket(const K &key) const
+    {
+        return static_cast<size_t>((static_cast<uint64_t>(H()(key)) * 0x9E3779B97F4A7C15ULL) >> (64 - m_bits));
+    }
+
+
+    inline size_t mask() const { return m_slots.size() - 1; }
+
+
+    inline void rehash(size_t capacity)
+    {
+        std::vector<Slot> slots(capacity);
+        slots.swap(m_slots);
+
+        m_bits = 0;
+        while ((size_t(1) << m_bits) < capacity) {
+            m_bits++;
+        }
+
+        m_size = 0;
+
+        for (Slot &slot : slots) {
+            if (slot.used) {
+                insert(slot.key, slot.value);
+            }
+        }
+    }
+
+
+    size_t m_bits  = 0;
+    size_t m_size  = 0;
+    std::vector<Slot> m_slots;
+};
+
+
+template <class K, class H> constexpr size_t FlatIndex<K, H>::npos;
+
+
+} /* namespace xmrig */
+
+
+#endif /* XMRIG_FLATINDEX_H */
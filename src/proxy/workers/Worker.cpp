@@ -26,17 +26,20 @@
 
 
 #include "base/net/stratum/SubmitResult.h"
+#include "base/tools/Chrono.h"
 #include "proxy/workers/Worker.h"
 
 
 xmrig::Worker::Worker() :
     m_id(0),
     m_hashrate(4),
+    m_key(0),
     m_accepted(0),
     m_connections(0),
     m_hashes(0),
     m_invalid(0),
     m_lastHash(0),
+    m_lastSeen(0),
     m_rejected(0)
 {
 }
@@ -47,11 +50,13 @@ xmrig::Worker::Worker(size_t id, const std::string &name, const std::string &ip)
     m_ip(ip),
     m_name(name),
     m_hashrate(4),
+    m_key(hash(name)),
     m_accepted(0),
     m_connections(1),
     m_hashes(0),
     m_invalid(0),
     m_lastHash(0),
+    m_lastSeen(Chrono::currentMSecsSinceEpoch()),
     m_rejected(0)
 {
 }
@@ -63,12 +68,20 @@ void xmrig::Worker::add(uint64_t diff)
     m_hashes += diff;
 
     m_hashrate.add(diff);
+    m_series.add(diff);
 
     using namespace std::chrono;
     m_lastHash = duration_cast<milliseconds>(system_clock::now().time_since_epoch()).count();
 }
 
 
+void xmrig::Worker::remove()
+{
+    m_connections--;
+    m_lastSeen = Chrono::currentMSecsSinceEpoch();
+}
+
+
 void xmrig::Worker::tick(uint64_t ticks)
 {
     m_hashrate.tick();
@@ -30,6 +30,7 @@
 
 
 #include "proxy/TickingCounter.h"
+#include "proxy/TimeSeries.h"
 
 
 namespace xmrig {
@@ -37,6 +38,8 @@ namespace xmrig {
 
 class Worker
 {
+    friend class StatsSnapshot;
+
 public:
     Worker();
     Worker(size_t id, const std::string &name, const std::string &ip);
@@ -46,28 +49,50 @@ public:
 
     inline const char *ip() const             { return m_ip.c_str(); }
     inline const char *name() const           { return m_name.c_str(); }
+    inline const TimeSeries &series() const   { return m_series; }
     inline double hashrate(int seconds) const { return m_hashrate.calc(seconds); }
     inline size_t id() const                  { return m_id; }
+    inline uint64_t key() const               { return m_key; }
     inline uint64_t accepted() const          { return m_accepted; }
     inline uint64_t connections() const       { return m_connections; }
     inline uint64_t hashes() const            { return m_hashes; }
     inline uint64_t invalid() const           { return m_invalid; }
     inline uint64_t lastHash() const          { return m_lastHash; }
+    inline uint64_t lastSeen() const          { return m_lastSeen; }
     inline uint64_t rejected() const          { return m_rejected; }
     inline void add(const char *ip)           { m_ip = ip; m_connections++; }
+    inline void close(uint64_t minute)        { m_series.close(minute); }
     inline void reject(bool invalid)          { invalid ? m_invalid++ : m_rejected++; }
-    inline void remove()                      { m_connections--; }
+    inline void setId(size_t id)              { m_id = id; }
+
+    void remove();
+
+    // 64 bit FNV-1a of the name, stable across restarts so share journal records can be joined by worker,
+    // wide enough that colliding names stay improbable with hundreds of thousands of workers.
+    static inline uint64_t hash(const std::string &name)
+    {
+        uint64_t hash = 0xCBF29CE484222325ULL;
+
+        for (const char c : name) {
+            hash = (hash ^ static_cast<uint8_t>(c)) * 0x100000001B3ULL;
+        }
+
+        return hash;
+    }
 
 private:
     size_t m_id;
     std::string m_ip;
     std::string m_name;
     TickingCounter<uint32_t> m_hashrate;
+    TimeSeries m_series;
+    uint64_t m_key;
     uint64_t m_accepted;
     uint64_t m_connections;
     uint64_t m_hashes;
     uint64_t m_invalid;
     uint64_t m_lastHash;
+    uint64_t m_lastSeen;
     uint64_t m_rejected;
 };
 
@@ -28,6 +28,7 @@
 
 #include "base/io/log/Log.h"
 #include "3rdparty/rapidjson/document.h"
+#include "base/tools/Chrono.h"
 #include "core/config/Config.h"
 #include "core/Controller.h"
 #include "proxy/events/AcceptEvent.h"
@@ -67,6 +68,27 @@ xmrig::Workers::~Workers()
 }
 
 
+const xmrig::Worker *xmrig::Workers::worker(const Miner *miner) const
+{
+    size_t index = 0;
+
+    return indexByMiner(miner, &index) ? &m_workers[index] : nullptr;
+}
+
+
+size_t xmrig::Workers::live() const
+{
+    size_t count = 0;
+    for (const Worker &worker : m_workers) {
+        if (worker.connections() > 0) {
+            count++;
+        }
+    }
+
+    return count;
+}
+
+
 void xmrig::Workers::printWorkers()
 {
     if (!isEnabled()) {
@@ -116,9 +138,9 @@ void xmrig::Workers::reset()
         return;
     }
 
-    for (const Miner *miner : m_controller->miners()) {
-        if (miner->mapperId() != -1) {
-            add(miner);
+    for (const auto &kv : m_controller->miners()) {
+        if (kv.second->mapperId() != -1) {
+            add(kv.second);
         }
     }
 }
@@ -126,6 +148,17 @@ void xmrig::Workers::reset()
 
 void xmrig::Workers::tick(uint64_t ticks)
 {
+    const uint64_t minute = TimeSeries::minute();
+    if (minute != m_minute) {
+        if (m_minute) {
+            for (Worker &worker : m_workers) {
+                worker.close(m_minute);
+            }
+        }
+
+        m_minute = minute;
+    }
+
     if ((ticks % 4) != 0) {
         return;
     }
@@ -133,6 +166,10 @@ void xmrig::Workers::tick(uint64_t ticks)
     for (Worker &worker : m_workers) {
         worker.tick(ticks);
     }
+
+    if ((ticks % 60) == 0) {
+        evict();
+    }
 }
 
 
@@ -235,11 +272,11 @@ void xmrig::Workers::onRejectedEvent(IEvent *event)
 
 bool xmrig::Workers::indexByMiner(const Miner *miner, size_t *index) const
 {
-    if (!miner || miner->mapperId() == -1 || m_miners.count(miner->id()) == 0) {
+    if (!miner || miner->mapperId() == -1) {
         return false;
     }
 
-    *index = m_miners.at(miner->id());
+    *index = m_miners.find(miner->id());
     return *index < m_workers.size();
 }
 
@@ -272,22 +309,21 @@ const char *xmrig::Workers::nameByMiner(const Miner *miner) const
 
 size_t xmrig::Workers::add(const Miner *miner)
 {
-    size_t worker_id = 0;
     const char *name = nameByMiner(miner);
     const std::string key(name == nullptr ? "unknown" : name);
+    size_t worker_id = m_map.find(key);
 
-    if (m_map.count(key) == 0) {
-        worker_id   = m_workers.size();
-        m_map[key] = worker_id;
+    if (worker_id == FlatIndex<std::string>::npos) {
+        worker_id = m_workers.size();
+        m_map.insert(key, worker_id);
 
         m_workers.push_back(Worker(worker_id, key, miner->ip()));
     }
     else {
-        worker_id = m_map.at(key);
         m_workers[worker_id].add(miner->ip());
     }
 
-    m_miners[miner->id()] = worker_id;
+    m_miners.insert(miner->id(), worker_id);
     return worker_id;
 }
 
@@ -313,6 +349,48 @@ void xmrig::Workers::accept(const AcceptEvent *event)
 }
 
 
+void xmrig::Workers::evict()
+{
+    const uint64_t timeout = m_controller->config()->workersTimeout() * 1000;
+    if (timeout == 0) {
+        return;
+    }
+
+    const uint64_t now = Chrono::currentMSecsSinceEpoch();
+    std::vector<size_t> moved(m_workers.size(), FlatIndex<std::string>::npos);
+    size_t size = 0;
+
+    for (size_t i = 0; i < m_workers.size(); ++i) {
+        Worker &worker = m_workers[i];
+
+        if (worker.connections() == 0 && now - worker.lastSeen() > timeout) {
+            m_map.erase(worker.name());
+            m_evicted++;
+
+            continue;
+        }
+
+        if (size != i) {
+            m_workers[size] = std::move(worker);
+            m_workers[size].setId(size);
+            m_map.insert(m_workers[size].name(), size);
+        }
+
+        moved[i] = size++;
+    }
+
+    if (size == m_workers.size()) {
+        return;
+    }
+
+    m_workers.erase(m_workers.begin() + static_cast<std::ptrdiff_t>(size), m_workers.end());
+
+    m_miners.forEach([&moved](const int64_t &, size_t &index) {
+        index = index < moved.size() ? moved[index] : index;
+    });
+}
+
+
 void xmrig::Workers::login(const LoginEvent *event)
 {
     if (event->miner()->routeId() != -1) {
@@ -350,4 +428,5 @@ void xmrig::Workers::remove(const CloseEvent *event)
     }
 
     m_workers[index].remove();
+    m_miners.erase(event->miner()->id());
 }
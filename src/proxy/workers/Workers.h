@@ -26,7 +26,6 @@
 #define XMRIG_WORKERS_H
 
 
-#include <map>
 #include <string>
 #include <vector>
 
@@ -34,6 +33,7 @@
 #include "3rdparty/rapidjson/fwd.h"
 #include "base/kernel/interfaces/IBaseListener.h"
 #include "proxy/interfaces/IEventListener.h"
+#include "proxy/workers/FlatIndex.h"
 #include "proxy/workers/Worker.h"
 
 
@@ -50,6 +50,8 @@ class SubmitEvent;
 
 class Workers : public IEventListener, public IBaseListener
 {
+    friend class StatsSnapshot;
+
 public:
     enum Mode {
         None,     // workers support disabled.
@@ -63,12 +65,15 @@ public:
     Workers(Controller *controller);
     ~Workers() override;
 
+    const Worker *worker(const Miner *miner) const;
+    size_t live() const;
     void printWorkers();
     void reset();
     void tick(uint64_t ticks);
 
     inline const std::vector<Worker> &workers() const { return m_workers; }
     inline Mode mode() const                          { return m_mode; }
+    inline uint64_t evicted() const                   { return m_evicted; }
 
     static const char *modeName(Mode mode);
     static Mode parseMode(const char *mode);
@@ -86,15 +91,18 @@ private:
     const char *nameByMiner(const Miner *miner) const;
     size_t add(const Miner *miner);
     void accept(const AcceptEvent *event);
+    void evict();
     void login(const LoginEvent *event);
     void reject(const SubmitEvent *event);
     void remove(const CloseEvent *event);
 
     Controller *m_controller;
+    FlatIndex<int64_t> m_miners;
+    FlatIndex<std::string> m_map;
     Mode m_mode;
-    std::map<int64_t, size_t> m_miners;
-    std::map<std::string, size_t> m_map;
     std::vector<Worker> m_workers;
+    uint64_t m_evicted = 0;
+    uint64_t m_minute  = 0;
 };
 
 
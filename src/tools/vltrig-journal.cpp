@@ -0,0 +1,374 @@
+/* XMRig
+ * Copyright (c) 2026      HashVault   <https://github.com/HashVault>, <root@hashvault.pro>
+ *
+ *   This program is free software: you can redistribute it and/or modify
+ *   it under the terms of the GNU General Public License as published by
+ *   the Free Software Foundation, either version 3 of the License, or
+ *   (at your option) any later version.
+ *
+ *   This program is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ *   GNU General Public License for more details.
+ *
+ *   You should have received a copy of the GNU General Public License
+ *   along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*
+ * Offline reader for the share journal written by the "share-journal" option. Segments are
+ * streamed in large blocks and every record is a fixed 48 byte struct, so filtering and
+ * aggregation run at memory bandwidth, without touching the running proxy.
+ */
+
+
+#include <cerrno>
+#include <cinttypes>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <map>
+#include <string>
+#include <vector>
+
+
+#include "proxy/ShareJournal.h"
+#include "proxy/workers/Worker.h"
+
+
+namespace xmrig {
+
+
+using Journal = ShareJournal;
+
+
+enum Group {
+    GroupWorker,
+    GroupMapper,
+    GroupHour,
+    GroupDay,
+    GroupNone
+};
+
+
+struct Options
+{
+    bool csv          = false;
+    bool donate       = true;
+    bool hasWorker    = false;
+    Group group       = GroupWorker;
+    int result        = -1;
+    uint64_t worker   = 0;
+    uint64_t from     = 0;
+    uint64_t to       = UINT64_MAX;
+};
+
+
+struct Total
+{
+    uint64_t count[3]   = {};
+    uint64_t hashes     = 0;
+    uint64_t latency    = 0;
+    uint64_t maxDiff    = 0;
+};
+
+
+static const size_t kBlock = 65536;
+static const char *kResults[] = { "accepted", "rejected", "invalid" };
+
+static std::map<uint64_t, std::string> names;
+
+
+static void usage()
+{
+    printf("Usage: vltrig-journal [OPTIONS] FILE...\n\n"
+           "  FILE                 journal segment shares-<ms>.bin, names are read from the .idx next to it\n"
+           "      --from=TIME      only shares at or after TIME, unix seconds\n"
+           "      --to=TIME        only shares before TIME, unix seconds\n"
+           "      --worker=NAME    only shares of worker NAME\n"
+           "      --result=RESULT  only accepted, rejected or invalid shares\n"
+           "      --no-donate      skip donation shares\n"
+           "      --group=KEY      aggregate by worker (default), mapper, hour, day or none\n"
+           "      --csv            print matching records as CSV instead of aggregating\n"
+           "  -h, --help           print this help\n");
+}
+
+
+static const char *value(const char *arg, const char *name)
+{
+    const size_t size = strlen(name);
+
+    return strncmp(arg, name, size) == 0 && arg[size] == '=' ? arg + size + 1 : nullptr;
+}
+
+
+static bool parse(int argc, char **argv, Options &options, std::vector<const char *> &files)
+{
+    for (int i = 1; i < argc; ++i) {
+        const char *arg = argv[i];
+        const char *v   = nullptr;
+
+        if (arg[0] != '-') {
+            files.push_back(arg);
+        }
+        else if ((v = value(arg, "--from"))) {
+            options.from = strtoull(v, nullptr, 10) * 1000;
+        }
+        else if ((v = value(arg, "--to"))) {
+            options.to = strtoull(v, nullptr, 10) * 1000;
+        }
+        else if ((v = value(arg, "--worker"))) {
+            options.hasWorker = true;
+            options.worker    = Worker::hash(v);
+        }
+        else if ((v = value(arg, "--result"))) {
+            for (int r = 0; r < 3; ++r) {
+                if (strcmp(v, kResults[r]) == 0) {
+                    options.result = r;
+                }
+            }
+
+            if (options.result < 0) {
+                fprintf(stderr, "unknown result \"%s\"\n", v);
+                return false;
+            }
+        }
+        else if ((v = value(arg, "--group"))) {
+            static const char *groups[] = { "worker", "mapper", "hour", "day", "none" };
+            size_t g = 0;
+
+            while (g <= GroupNone && strcmp(v, groups[g]) != 0) {
+                g++;
+            }
+
+            if (g > GroupNone) {
+                fprintf(stderr, "unknown group \"%s\"\n", v);
+                return false;
+            }
+
+            options.group = static_cast<Group>(g);
+        }
+        else if (strcmp(arg, "--no-donate") == 0) {
+            options.donate = false;
+        }
+        else if (strcmp(arg, "--csv") == 0) {
+            options.csv = true;
+        }
+        else {
+            usage();
+            return false;
+        }
+    }
+
+    if (files.empty()) {
+        usage();
+        return false;
+    }
+
+    return true;
+}
+
+
+static void loadNames(const char *path)
+{
+    std::string idx = path;
+    if (idx.size() > 4 && idx.compare(idx.size() - 4, 4, ".bin") == 0) {
+        idx.replace(idx.size() - 4, 4, ".idx");
+    }
+
+    FILE *fp = fopen(idx.c_str(), "rb");
+    if (!fp) {
+        return;
+    }
+
+    Journal::Header header{};
+    if (fread(&header, sizeof(header), 1, fp) == 1 && header.magic == Journal::kIndexMagic && header.recordSize == sizeof(Journal::Name)) {
+        Journal::Name name{};
+
+        for (uint64_t i = 0; i < header.capacity && fread(&name, sizeof(name), 1, fp) == 1; ++i) {
+            name.name[Journal::kNameSize - 1] = '\0';
+            names.emplace(name.worker, name.name);
+        }
+    }
+
+    fclose(fp);
+}
+
+
+static inline bool match(const Journal::Record &record, const Options &options)
+{
+    return record.timestamp >= options.from && record.timestamp < options.to &&
+           (!options.hasWorker || record.worker == options.worker) &&
+           (options.result < 0 || record.result == options.result) &&
+           (options.donate || !(record.flags & Journal::Donate));
+}
+
+
+static inline uint64_t key(const Journal::Record &record, Group group)
+{
+    switch (group) {
+    case GroupWorker:
+        return record.worker;
+
+    case GroupMapper:
+        return record.mapper;
+
+    case GroupHour:
+        return record.timestamp / 3600000 * 3600;
+
+    case GroupDay:
+        return record.timestamp / 86400000 * 86400;
+
+    default:
+        break;
+    }
+
+    return 0;
+}
+
+
+static std::string workerName(uint64_t worker)
+{
+    const auto it = names.find(worker);
+    if (it != names.end()) {
+        return it->second;
+    }
+
+    char buf[24];
+    snprintf(buf, sizeof(buf), "#%016" PRIx64, worker);
+
+    return buf;
+}
+
+
+static bool scan(const char *path, const Options &options, std::map<uint64_t, Total> &totals, uint64_t &scanned)
+{
+    FILE *fp = fopen(path, "rb");
+    if (!fp) {
+        fprintf(stderr, "%s: %s\n", path, strerror(errno));
+        return false;
+    }
+
+    Journal::Header header{};
+    if (fread(&header, sizeof(header), 1, fp) != 1 || header.magic != Journal::kMagic || header.version != Journal::kVersion || header.recordSize != sizeof(Journal::Record)) {
+        fprintf(stderr, "%s: not a share journal segment\n", path);
+        fclose(fp);
+
+        return false;
+    }
+
+    // the header keeps the time range, segments outside of the filter are skipped unread.
+    if (header.count == 0 || header.last < options.from || header.first >= options.to) {
+        fclose(fp);
+        return true;
+    }
+
+    if (!options.csv && options.group == GroupWorker) {
+        loadNames(path);
+    }
+
+    std::vector<Journal::Record> block(kBlock);
+    uint64_t left = header.count;
+
+    while (left) {
+        const size_t size = fread(block.data(), sizeof(Journal::Record), left < kBlock ? static_cast<size_t>(left) : kBlock, fp);
+        if (size == 0) {
+            break;
+        }
+
+        left    -= size;
+        scanned += size;
+
+        for (size_t i = 0; i < size; ++i) {
+            const Journal::Record &record = block[i];
+            if (!match(record, options)) {
+                continue;
+            }
+
+            if (options.csv) {
+                printf("%" PRIu64 ",%016" PRIx64 ",%u,%s,%u,%" PRIu64 ",%" PRIu64 ",%u,%u\n",
+                       record.timestamp, record.worker, record.mapper, kResults[record.result < 3 ? record.result : 2], record.error,
+                       record.diff, record.actualDiff, record.latency, record.flags);
+
+                continue;
+            }
+
+            Total &total = totals[key(record, options.group)];
+            total.count[record.result < 3 ? record.result : 2]++;
+
+            if (record.result == Journal::Accepted) {
+                total.hashes  += record.diff;
+                total.latency += record.latency;
+            }
+
+            if (record.actualDiff > total.maxDiff) {
+                total.maxDiff = record.actualDiff;
+            }
+        }
+    }
+
+    fclose(fp);
+
+    return true;
+}
+
+
+static void print(const std::map<uint64_t, Total> &totals, Group group)
+{
+    static const char *headers[] = { "WORKER", "MAPPER", "HOUR", "DAY", "TOTAL" };
+
+    printf("%-32s %12s %10s %10s %20s %10s %20s\n", headers[group], "ACCEPTED", "REJECTED", "INVALID", "HASHES", "AVG MS", "MAX DIFF");
+
+    for (const auto &kv : totals) {
+        const Total &total = kv.second;
+        std::string label;
+
+        if (group == GroupWorker) {
+            label = workerName(kv.first);
+        }
+        else if (group != GroupNone) {
+            label = std::to_string(kv.first);
+        }
+
+        printf("%-32s %12" PRIu64 " %10" PRIu64 " %10" PRIu64 " %20" PRIu64 " %10" PRIu64 " %20" PRIu64 "\n",
+               label.c_str(), total.count[0], total.count[1], total.count[2], total.hashes,
+               total.count[0] ? total.latency / total.count[0] : 0, total.maxDiff);
+    }
+}
+
+
+} /* namespace xmrig */
+
+
+int main(int argc, char **argv)
+{
+    using namespace xmrig;
+
+    Options options;
+    std::vector<const char *> files;
+
+    if (!parse(argc, argv, options, files)) {
+        return 1;
+    }
+
+    if (options.csv) {
+        printf("timestamp,worker,mapper,result,error,diff,actual_diff,latency,flags\n");
+    }
+
+    std::map<uint64_t, Total> totals;
+    uint64_t scanned = 0;
+    int rc = 0;
+
+    for (const char *path : files) {
+        if (!scan(path, options, totals, scanned)) {
+            rc = 1;
+        }
+    }
+
+    if (!options.csv) {
+        print(totals, options.group);
+        fprintf(stderr, "%" PRIu64 " records scanned\n", scanned);
+    }
+
+    return rc;
+}